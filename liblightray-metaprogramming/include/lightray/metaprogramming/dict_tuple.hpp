@@ -1,12 +1,16 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include <lightray/metaprogramming/traits/qualifier_traits.hpp>
 
 #include "cast.hpp"
 #include "type_pack.hpp"
+#include "value.hpp"
 #include "value_pack.hpp"
 
 
@@ -160,4 +164,273 @@ namespace lightray::mtp
     template <auto... Keys, typename... Ts>
     dict_tuple(value_pack_t<Keys...>, Ts...) -> dict_tuple<value_pack_t<Keys...>, type_pack_t<Ts...>>;
 
+    namespace detail
+    {
+        // Tags naming a key and an index of an indexed_dict_tuple. They are only ever used as pointers.
+        template <auto Key>
+        struct indexed_dict_tuple_key;
+
+        template <std::size_t I>
+        struct indexed_dict_tuple_index;
+
+        template <auto Key, std::size_t I>
+        struct indexed_dict_tuple_key_slot
+        {
+            static auto index_of(indexed_dict_tuple_key<Key>*) noexcept -> std::integral_constant<std::size_t, I>;
+        };
+
+        /*
+         * Maps each key to its index through one overload per key, so that looking a key up
+         * is a single overload resolution among plain functions instead of a template argument
+         * deduction against every key. An unknown key maps to sizeof...(Keys).
+         *
+         * Author: P. Lutchanont
+         */
+        template <typename ISeq, auto... Keys>
+        struct indexed_dict_tuple_key_slots;
+
+        template <std::size_t... Is, auto... Keys>
+        struct indexed_dict_tuple_key_slots<std::index_sequence<Is...>, Keys...> : indexed_dict_tuple_key_slot<Keys, Is>...
+        {
+            using indexed_dict_tuple_key_slot<Keys, Is>::index_of...;
+
+            static auto index_of(...) noexcept -> std::integral_constant<std::size_t, sizeof...(Keys)>;
+        };
+
+        template <auto Key, typename KeySlots>
+        constexpr std::size_t indexed_dict_tuple_key_index = decltype(
+            KeySlots::index_of(static_cast<indexed_dict_tuple_key<Key>*>(nullptr))
+        )::value;
+
+        /*
+         * Makes the I-th element of an indexed_dict_tuple, of type T, from the argument whose key index
+         * in KeyIs is I, or by default construction if there is none.
+         */
+        template <typename T, std::size_t I, std::size_t... KeyIs, typename... Args>
+        constexpr auto indexed_dict_tuple_make_item(Args&&... args) -> T
+        {
+            constexpr auto arg = first_true_index<(KeyIs == I)...>();
+            if constexpr (arg < sizeof...(Args))
+                return T(std::get<arg>(std::forward_as_tuple(std::forward<Args>(args)...)));
+            else
+                return T();
+        }
+
+        template <std::size_t I, typename T>
+        struct indexed_dict_tuple_leaf : dict_tuple_leaf<I, T>
+        {
+            using element_type = T;
+
+            using dict_tuple_leaf<I, T>::dict_tuple_leaf;
+
+            static auto leaf_at(indexed_dict_tuple_index<I>*) noexcept -> indexed_dict_tuple_leaf;
+        };
+
+        // Storage of an indexed_dict_tuple whose elements have different types, with one leaf per index.
+        template <typename ISeq, typename... Ts>
+        struct indexed_dict_tuple_leaves;
+
+        template <std::size_t... Is, typename... Ts>
+        struct indexed_dict_tuple_leaves<std::index_sequence<Is...>, Ts...> : indexed_dict_tuple_leaf<Is, Ts>...
+        {
+            using indexed_dict_tuple_leaf<Is, Ts>::leaf_at...;
+
+            template <std::size_t I>
+            using leaf_type = decltype(leaf_at(static_cast<indexed_dict_tuple_index<I>*>(nullptr)));
+
+            template <std::size_t I>
+            using element_type = typename leaf_type<I>::element_type;
+
+            indexed_dict_tuple_leaves() = default;
+
+            template <std::size_t... KeyIs, typename... Args>
+            constexpr indexed_dict_tuple_leaves(std::index_sequence<KeyIs...>, Args&&... args)
+            : indexed_dict_tuple_leaf<Is, Ts>(indexed_dict_tuple_make_item<Ts, Is, KeyIs...>(std::forward<Args>(args)...))...
+            {}
+
+            // Every element in order, which pairs each argument with its leaf directly.
+            template <typename... Args>
+            requires (sizeof...(Args) == sizeof...(Ts))
+            constexpr indexed_dict_tuple_leaves(std::index_sequence<Is...>, Args&&... args)
+            : indexed_dict_tuple_leaf<Is, Ts>(std::forward<Args>(args))...
+            {}
+
+        }; // struct indexed_dict_tuple_leaves
+
+        // Storage of an indexed_dict_tuple whose elements all have type T.
+        template <typename T, std::size_t N>
+        struct indexed_dict_tuple_array
+        {
+        private:
+            template <std::size_t... Is, std::size_t... KeyIs, typename... Args>
+            constexpr indexed_dict_tuple_array(std::index_sequence<Is...>, std::index_sequence<KeyIs...>, Args&&... args)
+            : items{indexed_dict_tuple_make_item<T, Is, KeyIs...>(std::forward<Args>(args)...)...}
+            {}
+
+        public:
+            template <std::size_t I>
+            using element_type = T;
+
+            std::array<T, N> items;
+
+            indexed_dict_tuple_array() = default;
+
+            template <std::size_t... KeyIs, typename... Args>
+            constexpr indexed_dict_tuple_array(std::index_sequence<KeyIs...> key_indices, Args&&... args)
+            : indexed_dict_tuple_array(std::make_index_sequence<N>{}, key_indices, std::forward<Args>(args)...)
+            {}
+
+            // Every element in order, which needs no argument lookup.
+            template <typename... Args>
+            requires (sizeof...(Args) == N)
+            constexpr indexed_dict_tuple_array(std::make_index_sequence<N>, Args&&... args)
+            : items{T(std::forward<Args>(args))...}
+            {}
+
+        }; // struct indexed_dict_tuple_array
+
+        template <typename... Ts>
+        struct indexed_dict_tuple_storage
+        {
+            using type = indexed_dict_tuple_leaves<std::index_sequence_for<Ts...>, Ts...>;
+            static constexpr bool flat = false;
+        };
+
+        template <typename T, typename... Ts>
+        requires (std::is_same_v<T, Ts> && ...)
+        struct indexed_dict_tuple_storage<T, Ts...>
+        {
+            using type = indexed_dict_tuple_array<T, 1 + sizeof...(Ts)>;
+            static constexpr bool flat = true;
+        };
+
+    } // namespace detail
+
+    /*
+     * A dict_tuple which maps each key to its index once, through an overload set over the keys,
+     * and accesses its elements by index, instead of resolving each key against every leaf.
+     *
+     * Its elements are stored in a std::array if they all have the same type, and in leaves
+     * indexed by position otherwise. It has the same interface as dict_tuple, and is cheaper
+     * to compile for many keys.
+     *
+     * Author: P. Lutchanont
+     */
+    template <typename Keys, typename ValueTypes>
+    struct indexed_dict_tuple;
+
+    template <auto... Keys, typename... Ts>
+    requires (sizeof...(Keys) == sizeof...(Ts))
+    struct indexed_dict_tuple<value_pack_t<Keys...>, type_pack_t<Ts...>>
+    {
+    private:
+        using storage_type = typename detail::indexed_dict_tuple_storage<Ts...>::type;
+
+        static constexpr bool flat = detail::indexed_dict_tuple_storage<Ts...>::flat;
+
+        /*
+         * Keys are substituted once, into key_slots, which keys are then looked up in.
+         * Looking them up through a member variable template instead would substitute them again
+         * for each key, which is much slower to compile.
+         */
+        using key_slots = detail::indexed_dict_tuple_key_slots<std::make_index_sequence<sizeof...(Keys)>, Keys...>;
+
+        storage_type _storage;
+
+    public:
+        // The element type of the value at the given key.
+        template <auto Key>
+        requires (detail::indexed_dict_tuple_key_index<Key, key_slots> < sizeof...(Ts))
+        using element_type = typename storage_type::template element_type<detail::indexed_dict_tuple_key_index<Key, key_slots>>;
+
+        static constexpr auto keys() noexcept -> value_pack_t<Keys...> { return {}; }
+
+        // Returns the number of elements this indexed_dict_tuple contains
+        // size() == sizeof...(Ts) == sizeof...(Keys)
+        static constexpr auto size() noexcept -> std::size_t { return sizeof...(Ts); }
+
+        // Get the element reference at the given key.
+        template <auto Key>
+        constexpr auto get() & noexcept -> decltype(auto)
+        {
+            constexpr auto i = detail::indexed_dict_tuple_key_index<Key, key_slots>;
+            static_assert(i < sizeof...(Ts), "indexed_dict_tuple has no such key");
+            if constexpr (flat) return std::get<i>(_storage.items);
+            else                return static_cast<      typename storage_type::template leaf_type<i>& >(_storage).get();
+        }
+
+        // Get the element reference at the given key.
+        template <auto Key>
+        constexpr auto get() const & noexcept -> decltype(auto)
+        {
+            constexpr auto i = detail::indexed_dict_tuple_key_index<Key, key_slots>;
+            static_assert(i < sizeof...(Ts), "indexed_dict_tuple has no such key");
+            if constexpr (flat) return std::get<i>(_storage.items);
+            else                return static_cast<const typename storage_type::template leaf_type<i>& >(_storage).get();
+        }
+
+        // Get the element reference at the given key.
+        template <auto Key>
+        constexpr auto get() && noexcept -> decltype(auto)
+        {
+            constexpr auto i = detail::indexed_dict_tuple_key_index<Key, key_slots>;
+            static_assert(i < sizeof...(Ts), "indexed_dict_tuple has no such key");
+            if constexpr (flat) return std::get<i>(std::move(_storage.items));
+            else                return static_cast<      typename storage_type::template leaf_type<i>&&>(_storage).get();
+        }
+
+        // Get the element reference at the given key.
+        template <auto Key>
+        constexpr auto get() const && noexcept -> decltype(auto)
+        {
+            constexpr auto i = detail::indexed_dict_tuple_key_index<Key, key_slots>;
+            static_assert(i < sizeof...(Ts), "indexed_dict_tuple has no such key");
+            if constexpr (flat) return std::get<i>(std::move(_storage.items));
+            else                return static_cast<const typename storage_type::template leaf_type<i>&&>(_storage).get();
+        }
+
+        // Default constructs each element.
+        indexed_dict_tuple() = default;
+
+        /*
+         * Initializes each element using each argument according to the order
+         * of the keys of this dict tuple.
+         *
+         * If sizeof...(Args) is less than size(), then the remaining elements
+         * are default constructed.
+         */
+        template <typename... Args>
+        requires (sizeof...(Args) <= sizeof...(Ts))
+              && (sizeof...(Args) != 1 || !(std::is_same_v<std::remove_cvref_t<Args>, indexed_dict_tuple> && ...))
+        constexpr indexed_dict_tuple(Args&&... args)
+        : _storage(std::index_sequence_for<Args...>{}, std::forward<Args>(args)...)
+        {}
+
+        /*
+         * Initializes each element using each argument according to the order
+         * of the given keys in the first parameter.
+         *
+         * The remaining elements with unspecified keys are default constructed.
+         */
+        template <auto... KeyArgs, typename... Args>
+        requires (sizeof...(KeyArgs) == sizeof...(Args))
+        constexpr indexed_dict_tuple(value_pack_t<KeyArgs...>, Args&&... args)
+        : _storage(std::index_sequence<detail::indexed_dict_tuple_key_index<KeyArgs, key_slots>...>{}, std::forward<Args>(args)...)
+        {
+            static_assert(((detail::indexed_dict_tuple_key_index<KeyArgs, key_slots> < sizeof...(Ts)) && ...), "indexed_dict_tuple has no such key");
+        }
+
+        // Initializes each element in the order of the keys of this dict tuple, without looking any key up.
+        template <typename... Args>
+        requires (sizeof...(Args) == sizeof...(Ts))
+        constexpr indexed_dict_tuple(value_pack_t<Keys...>, Args&&... args)
+        : _storage(std::index_sequence_for<Ts...>{}, std::forward<Args>(args)...)
+        {}
+
+    }; // struct indexed_dict_tuple<value_pack_t<Keys...>, type_pack_t<Ts...>>
+
+    // Deduce template parameters by value.
+    template <auto... Keys, typename... Ts>
+    indexed_dict_tuple(value_pack_t<Keys...>, Ts...) -> indexed_dict_tuple<value_pack_t<Keys...>, type_pack_t<Ts...>>;
+
 } // namespace lightray::mtp
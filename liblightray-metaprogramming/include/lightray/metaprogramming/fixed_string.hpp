@@ -1,15 +1,67 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 
 namespace lightray::mtp
 {
     template <typename CharT, std::size_t Len, typename Traits = std::char_traits<CharT>>
+    struct basic_fixed_string;
+
+    template <std::size_t Len>
+    struct fixed_string;
+
+    template <std::size_t Len>
+    struct wfixed_string;
+
+    template <std::size_t Len>
+    struct u16fixed_string;
+
+    template <std::size_t Len>
+    struct u32fixed_string;
+
+    namespace detail
+    {
+        /*
+         * The fixed string type holding Len characters of CharT, i.e. fixed_string<Len> for char.
+         * Results of operations on fixed strings are of this type, so that they can be passed where
+         * a fixed_string is expected, e.g. as a template <fixed_string Name> argument.
+         */
+        template <typename CharT, std::size_t Len, typename Traits>
+        struct fixed_string_of { using type = basic_fixed_string<CharT, Len, Traits>; };
+
+        template <std::size_t Len>
+        struct fixed_string_of<char, Len, std::char_traits<char>> { using type = fixed_string<Len>; };
+
+        template <std::size_t Len>
+        struct fixed_string_of<wchar_t, Len, std::char_traits<wchar_t>> { using type = wfixed_string<Len>; };
+
+        template <std::size_t Len>
+        struct fixed_string_of<char16_t, Len, std::char_traits<char16_t>> { using type = u16fixed_string<Len>; };
+
+        template <std::size_t Len>
+        struct fixed_string_of<char32_t, Len, std::char_traits<char32_t>> { using type = u32fixed_string<Len>; };
+
+        template <typename CharT, std::size_t Len, typename Traits>
+        using fixed_string_of_t = typename fixed_string_of<CharT, Len, Traits>::type;
+
+    } // namespace detail
+
+    /*
+     * A string of Len characters, followed by a null terminator, usable as a non-type template parameter.
+     *
+     * Note that size() and view() count the null terminator, while find, starts_with, ends_with,
+     * substr and hash only consider the Len characters before it.
+     */
+    template <typename CharT, std::size_t Len, typename Traits>
     struct basic_fixed_string
     {
         using container_type            = std::array<CharT, Len + 1>;
@@ -27,32 +79,34 @@ namespace lightray::mtp
         using reverse_iterator          = typename container_type::reverse_iterator;
         using const_reverse_iterator    = typename container_type::const_reverse_iterator;
 
+        using view_type                 = std::basic_string_view<CharT, Traits>;
+
+        static constexpr size_type npos = view_type::npos;
+
         std::array<CharT, Len + 1> _data;
 
         constexpr basic_fixed_string() noexcept : _data{} {}
 
         constexpr basic_fixed_string(std::span<std::add_const_t<CharT>, Len> str) noexcept
-        {
-            std::copy(str.begin(), str.end(), _data.begin());
-            _data[Len] = 0;
-        }
+        :   basic_fixed_string{str.data(), std::make_index_sequence<Len>{}}
+        {}
 
         constexpr basic_fixed_string(std::add_const_t<CharT> (&str)[Len + 1]) noexcept
-        {
-            std::copy(std::begin(str), std::end(str), _data.begin());
-            _data[Len] = 0;
-        }
+        :   basic_fixed_string{str, std::make_index_sequence<Len>{}}
+        {}
 
         constexpr auto operator=(std::span<CharT, Len> str) noexcept -> basic_fixed_string&
         {
-            std::copy(str.begin(), str.end(), _data.begin());
+            for (size_type i = 0; i < Len; ++i)
+                _data[i] = str[i];
             _data[Len] = 0;
             return *this;
         }
 
         constexpr auto operator=(CharT (&str)[Len + 1]) noexcept -> basic_fixed_string&
         {
-            std::copy(std::begin(str), std::end(str), _data.begin());
+            for (size_type i = 0; i < Len; ++i)
+                _data[i] = str[i];
             _data[Len] = 0;
             return *this;
         }
@@ -192,6 +246,81 @@ namespace lightray::mtp
             return size();
         }
 
+        /*
+         * Returns the Count characters starting at Pos, or as many as there are, as a fixed string.
+         */
+        template <size_type Pos, size_type Count = npos> requires (Pos <= Len)
+        constexpr auto substr() const noexcept -> detail::fixed_string_of_t<CharT, std::min(Count, Len - Pos), Traits>
+        {
+            detail::fixed_string_of_t<CharT, std::min(Count, Len - Pos), Traits> result;
+            for (size_type i = 0; i < std::min(Count, Len - Pos); ++i)
+                result[i] = _data[Pos + i];
+            return result;
+        }
+
+        /*
+         * Returns the position of the first occurrence of str at or after pos, or npos if there is none.
+         */
+        constexpr auto find(view_type str, size_type pos = 0) const noexcept -> size_type
+        {
+            return view_type{_data.data(), Len}.find(str, pos);
+        }
+
+        template <std::size_t OtherLen>
+        constexpr auto find(const basic_fixed_string<CharT, OtherLen, Traits>& str, size_type pos = 0) const noexcept
+        -> size_type
+        {
+            return find(view_type{str.c_str(), OtherLen}, pos);
+        }
+
+        constexpr auto find(CharT c, size_type pos = 0) const noexcept -> size_type
+        {
+            return view_type{_data.data(), Len}.find(c, pos);
+        }
+
+        constexpr auto starts_with(view_type str) const noexcept -> bool
+        {
+            return view_type{_data.data(), Len}.starts_with(str);
+        }
+
+        template <std::size_t OtherLen>
+        constexpr auto starts_with(const basic_fixed_string<CharT, OtherLen, Traits>& str) const noexcept -> bool
+        {
+            return starts_with(view_type{str.c_str(), OtherLen});
+        }
+
+        constexpr auto starts_with(CharT c) const noexcept -> bool
+        {
+            return view_type{_data.data(), Len}.starts_with(c);
+        }
+
+        constexpr auto ends_with(view_type str) const noexcept -> bool
+        {
+            return view_type{_data.data(), Len}.ends_with(str);
+        }
+
+        template <std::size_t OtherLen>
+        constexpr auto ends_with(const basic_fixed_string<CharT, OtherLen, Traits>& str) const noexcept -> bool
+        {
+            return ends_with(view_type{str.c_str(), OtherLen});
+        }
+
+        constexpr auto ends_with(CharT c) const noexcept -> bool
+        {
+            return view_type{_data.data(), Len}.ends_with(c);
+        }
+
+        /*
+         * Returns the 64-bit FNV-1a hash of the characters, without the null terminator.
+         */
+        constexpr auto hash() const noexcept -> std::uint64_t
+        {
+            std::uint64_t h = 0xcbf29ce484222325ull;
+            for (size_type i = 0; i < Len; ++i)
+                h = (h ^ static_cast<std::make_unsigned_t<CharT>>(_data[i])) * 0x100000001b3ull;
+            return h;
+        }
+
         template <std::size_t OtherLen>
         constexpr auto compare(const basic_fixed_string<CharT, OtherLen, Traits>& other) const noexcept
         -> int
@@ -213,11 +342,51 @@ namespace lightray::mtp
             return this->view() <=> other.view();
         }
 
+    private:
+        // Initializes every character directly, instead of zeroing _data then copying into it.
+        template <std::size_t... Is>
+        constexpr basic_fixed_string(const CharT* str, std::index_sequence<Is...>) noexcept
+        :   _data{str[Is]..., CharT{}}
+        {}
+
     }; // struct basic_fixed_string
 
     template <typename CharT, std::size_t Len>
     basic_fixed_string(CharT (&)[Len]) -> basic_fixed_string<std::remove_const_t<CharT>, Len - 1>;
 
+    /*
+     * Concatenates lhs and rhs. A string literal on either side is concatenated without its null terminator.
+     * For example:
+     *  constexpr auto name = fixed_string("lightray") + "::" + fixed_string("refl");
+     */
+    template <typename CharT, std::size_t LhsLen, std::size_t RhsLen, typename Traits>
+    constexpr auto operator+(
+        const basic_fixed_string<CharT, LhsLen, Traits>& lhs,
+        const basic_fixed_string<CharT, RhsLen, Traits>& rhs
+    ) noexcept -> detail::fixed_string_of_t<CharT, LhsLen + RhsLen, Traits>
+    {
+        detail::fixed_string_of_t<CharT, LhsLen + RhsLen, Traits> result;
+        for (std::size_t i = 0; i < LhsLen; ++i)
+            result[i] = lhs[i];
+        for (std::size_t i = 0; i < RhsLen; ++i)
+            result[LhsLen + i] = rhs[i];
+        return result;
+    }
+
+    template <typename CharT, std::size_t LhsLen, std::size_t RhsSize, typename Traits>
+    constexpr auto operator+(const basic_fixed_string<CharT, LhsLen, Traits>& lhs, const CharT (&rhs)[RhsSize]) noexcept
+    -> detail::fixed_string_of_t<CharT, LhsLen + RhsSize - 1, Traits>
+    {
+        return lhs + basic_fixed_string<CharT, RhsSize - 1, Traits>(rhs);
+    }
+
+    template <typename CharT, std::size_t LhsSize, std::size_t RhsLen, typename Traits>
+    constexpr auto operator+(const CharT (&lhs)[LhsSize], const basic_fixed_string<CharT, RhsLen, Traits>& rhs) noexcept
+    -> detail::fixed_string_of_t<CharT, LhsSize - 1 + RhsLen, Traits>
+    {
+        return basic_fixed_string<CharT, LhsSize - 1, Traits>(lhs) + rhs;
+    }
+
     template <typename CharT, std::size_t Len, typename Traits>
     std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const basic_fixed_string<CharT, Len, Traits>& s)
     {
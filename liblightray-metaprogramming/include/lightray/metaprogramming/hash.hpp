@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace lightray::mtp
+{
+    namespace detail
+    {
+        constexpr std::uint64_t hash_secret[4] = {
+            0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75acac8bull
+        };
+
+        constexpr auto hash_multiply(std::uint64_t& a, std::uint64_t& b) noexcept -> void
+        {
+#       if defined(__SIZEOF_INT128__)
+            const auto r = static_cast<unsigned __int128>(a) * b;
+            a = static_cast<std::uint64_t>(r);
+            b = static_cast<std::uint64_t>(r >> 64);
+#       else
+            const std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a);
+            const std::uint64_t lb = static_cast<std::uint32_t>(b);
+            const std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+            const std::uint64_t t = rl + (rm0 << 32);
+            std::uint64_t c = t < rl;
+            const std::uint64_t lo = t + (rm1 << 32);
+            c += lo < t;
+            a = lo;
+            b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#       endif
+        }
+
+        constexpr auto hash_mix(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+        {
+            hash_multiply(a, b);
+            return a ^ b;
+        }
+
+        inline auto hash_read8(const unsigned char* p) noexcept -> std::uint64_t
+        {
+            std::uint64_t v;
+            std::memcpy(&v, p, 8);
+            return v;
+        }
+
+        inline auto hash_read4(const unsigned char* p) noexcept -> std::uint64_t
+        {
+            std::uint32_t v;
+            std::memcpy(&v, p, 4);
+            return v;
+        }
+
+        inline auto hash_read3(const unsigned char* p, std::size_t k) noexcept -> std::uint64_t
+        {
+            return (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[k >> 1]} << 8) | p[k - 1];
+        }
+
+    } // namespace detail
+
+    /*
+     * Hashes len bytes starting at data in a single pass.
+     *
+     * The algorithm is derived from wyhash (public domain), and has much better
+     * avalanche behaviour than combine_hash, while being fast on short inputs.
+     * The result depends on the native byte order.
+     */
+    inline auto hash_bytes(const void* data, std::size_t len, std::uint64_t seed = 0) noexcept -> std::uint64_t
+    {
+        using detail::hash_secret;
+        using detail::hash_mix;
+        using detail::hash_read8;
+        using detail::hash_read4;
+
+        const auto* p = static_cast<const unsigned char*>(data);
+        std::uint64_t a, b;
+
+        seed ^= hash_mix(seed ^ hash_secret[0], hash_secret[1]);
+
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                a = (hash_read4(p) << 32) | hash_read4(p + ((len >> 3) << 2));
+                b = (hash_read4(p + len - 4) << 32) | hash_read4(p + len - 4 - ((len >> 3) << 2));
+            }
+            else if (len > 0)
+            {
+                a = detail::hash_read3(p, len);
+                b = 0;
+            }
+            else
+                a = b = 0;
+        }
+        else
+        {
+            std::size_t i = len;
+            if (i > 48)
+            {
+                std::uint64_t see1 = seed, see2 = seed;
+                do
+                {
+                    seed = hash_mix(hash_read8(p     ) ^ hash_secret[1], hash_read8(p +  8) ^ seed);
+                    see1 = hash_mix(hash_read8(p + 16) ^ hash_secret[2], hash_read8(p + 24) ^ see1);
+                    see2 = hash_mix(hash_read8(p + 32) ^ hash_secret[3], hash_read8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16)
+            {
+                seed = hash_mix(hash_read8(p) ^ hash_secret[1], hash_read8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = hash_read8(p + i - 16);
+            b = hash_read8(p + i - 8);
+        }
+
+        a ^= hash_secret[1];
+        b ^= seed;
+        detail::hash_multiply(a, b);
+        return hash_mix(a ^ hash_secret[0] ^ len, b ^ hash_secret[1]);
+    }
+
+    /*
+     * Mixes next_hash into seed. Unlike combine_hash, every bit of both operands
+     * affects every bit of the result, so weak element hashes (e.g. std::hash<int>,
+     * which is the identity on most implementations) still give well distributed results.
+     */
+    constexpr auto mix_hash(std::uint64_t seed, std::uint64_t next_hash) noexcept -> std::uint64_t
+    {
+        return detail::hash_mix(seed ^ detail::hash_secret[0], next_hash ^ detail::hash_secret[1]);
+    }
+
+} // namespace lightray::mtp
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cstddef>
+#include <type_traits>
 
 #include <lightray/metaprogramming/traits/unified_pointer_traits.hpp>
 #include "value.hpp"
@@ -10,55 +11,48 @@ namespace lightray::mtp
 {
     namespace detail
     {
-#       pragma pack(push, 1)
-        template <typename PaddedT, std::size_t NumPaddingBytes>
-        struct offset_of_padded_object
-        {
-            std::array<std::byte, NumPaddingBytes> padding_bytes;
-            PaddedT padded_obj;
-        }; // struct offset_of_padded_object
-#       pragma pack(pop)
-
-        template <typename PaddedT>
-        struct offset_of_padded_object<PaddedT, 0>
-        {
-            PaddedT padded_obj;
-        };
-
-        template <typename T, typename PaddedT, std::size_t NumPaddingBytes>
+        /*
+         * An object of type T overlaid with a byte at every offset into it, so that the offset
+         * of any member of T is found by comparing the member's address against those of the bytes.
+         * The extra byte past the end covers members of size 0 at the very end of T.
+         */
+        template <typename T>
         union offset_of_storage_t
         {
             char dummy_init;
-            offset_of_padded_object<PaddedT, NumPaddingBytes> padded_member;
             T obj;
+            std::byte bytes[sizeof(T) + 1];
         };
 
-        template <typename T, typename PaddedT, std::size_t NumPaddingBytes>
-        constexpr offset_of_storage_t<T, PaddedT, NumPaddingBytes> offset_of_storage = {0};
-
-        template <typename C, typename T, typename DeclaringType, T DeclaringType::* MemberPtr>
-        consteval auto constexpr_offset_of(value_t<MemberPtr>) noexcept -> std::ptrdiff_t
+        template <typename T>
+        constexpr offset_of_storage_t<T> offset_of_storage = {0};
+
+        /*
+         * Binary searches the bytes of a single probe object for the member, which takes no
+         * instantiation per probe, unlike padding a copy of the member's type by each candidate offset.
+         *
+         * The search orders the addresses of members of different union members, which the standard
+         * leaves unspecified, and so outside of constant expressions. g++ evaluates it by address,
+         * but other compilers may reject it. Where the member's name is known, __builtin_offsetof
+         * is the portable alternative (see refl::member_offsets).
+         */
+        template <typename C, typename T, typename DeclaringType>
+        consteval auto constexpr_offset_of(T DeclaringType::* member_ptr) noexcept -> std::ptrdiff_t
         {
-            constexpr auto find_offset = [](auto&& self, auto low, auto high)
-            {
-                const auto mid = (high + low) / value<2>;
-                constexpr auto& storage = detail::offset_of_storage<C, T, mid.value>;
-                constexpr auto* real_addr = &(storage.obj.*MemberPtr);
-                constexpr auto* padded_addr = &storage.padded_member.padded_obj;
-
+            const auto& storage = offset_of_storage<C>;
+            const void* member_addr = &(storage.obj.*member_ptr);
 
-                if constexpr (padded_addr == real_addr)
-                    return mid;
-
-                else if constexpr (padded_addr < real_addr)
-                    return self(self, mid + value<1>, high);
-
-                else if constexpr (padded_addr > real_addr)
-                    return self(self, low, mid - value<1>);
-
-            };
-
-            return find_offset(find_offset, value<0>, value<sizeof(C)>).value;
+            std::size_t low = 0;
+            std::size_t high = sizeof(C);
+            while (low < high)
+            {
+                const std::size_t mid = (low + high) / 2;
+                if (static_cast<const void*>(&storage.bytes[mid]) < member_addr)
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+            return static_cast<std::ptrdiff_t>(low);
         }
     } // namespace detail
 
@@ -67,16 +61,27 @@ namespace lightray::mtp
         typename ClassT = traits::unified_pointer_traits<decltype(MemberPtr)>::class_type
     >
     requires std::is_member_object_pointer_v<decltype(MemberPtr)>
-    constexpr std::ptrdiff_t offset_of = detail::constexpr_offset_of<ClassT>(value<MemberPtr>);
+    constexpr std::ptrdiff_t offset_of = detail::constexpr_offset_of<ClassT>(MemberPtr);
+
+    /*
+     * Returns the offsets of the given members of C, in order, all probed through the same object.
+     * Like offset_of, it relies on g++ to constant evaluate the probe. For example:
+     *  constexpr auto offsets = offsets_of<vec3>(&vec3::x, &vec3::y, &vec3::z);
+     */
+    template <typename C, typename... Ts, typename... DeclaringTypes>
+    consteval auto offsets_of(Ts DeclaringTypes::*... member_ptrs) noexcept -> std::array<std::ptrdiff_t, sizeof...(Ts)>
+    {
+        return {detail::constexpr_offset_of<C>(member_ptrs)...};
+    }
 
     template <typename C, typename T>
     requires std::is_member_object_pointer_v<T C::*>
     auto runtime_offset_of(T C::* member_ptr) noexcept -> std::ptrdiff_t
     {
-        const auto& storage = detail::offset_of_storage<C, T, 0>;
+        const auto& storage = detail::offset_of_storage<C>;
         return 
             reinterpret_cast<const volatile char*>(&(storage.obj.*member_ptr))
-          - reinterpret_cast<const volatile char*>(&storage.padded_member.padded_obj);
+          - reinterpret_cast<const volatile char*>(&storage.obj);
     }
 
 } // namespace lightray::mtp
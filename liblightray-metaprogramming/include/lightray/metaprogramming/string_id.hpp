@@ -0,0 +1,55 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <lightray/metaprogramming/fixed_string.hpp>
+
+namespace lightray::mtp
+{
+    /*
+     * A string interned as the 64-bit hash of its characters, see intern.
+     *
+     * As a non-type template parameter, a fixed_string is mangled character by character into
+     * every symbol naming it, and strings of each length are of a distinct type. A string_id
+     * is a single integer of a single type, so symbols naming it stay short, and comparing two
+     * of them compares two integers.
+     *
+     * Different strings may, however unlikely, have the same id. Ids used as the keys of one
+     * dict_tuple must therefore be checked to be distinct, as dyn does for its vtables.
+     */
+    struct string_id
+    {
+        std::uint64_t value;
+
+        constexpr auto operator==(const string_id&) const noexcept -> bool = default;
+        constexpr auto operator<=>(const string_id&) const noexcept -> std::strong_ordering = default;
+
+    }; // struct string_id
+
+    /*
+     * Returns the id of str, which is the same for every string with the same characters.
+     * For example:
+     *  static_assert(intern(fixed_string("x")) == intern(fixed_string("x")));
+     */
+    template <typename CharT, std::size_t Len, typename Traits>
+    constexpr auto intern(const basic_fixed_string<CharT, Len, Traits>& str) noexcept -> string_id
+    {
+        return {str.hash()};
+    }
+
+    /*
+     * Returns whether the given ids are all distinct.
+     */
+    constexpr auto all_distinct(std::span<const string_id> ids) noexcept -> bool
+    {
+        for (std::size_t i = 0; i < ids.size(); ++i)
+            for (std::size_t j = i + 1; j < ids.size(); ++j)
+                if (ids[i] == ids[j])
+                    return false;
+        return true;
+    }
+
+} // namespace lightray::mtp
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 #include <lightray/metaprogramming/concepts/functor.hpp>
@@ -32,6 +34,71 @@ namespace lightray::mtp
     template <typename... Ts>
     struct type_pack_t;
 
+    namespace detail
+    {
+        /*
+         * The I-th type of Ts. Uses the compiler's __type_pack_element when it has one,
+         * and otherwise deduces it from the indexed bases of type_pack_indexer,
+         * which costs no recursive instantiation either.
+         *
+         * __has_builtin is tested in an #if of its own, as a preprocessor without it
+         * would fail on __has_builtin(...) even after defined(__has_builtin) is false.
+         */
+#if defined(__has_builtin)
+#  if __has_builtin(__type_pack_element)
+#    define LIGHTRAY_MTP_HAS_TYPE_PACK_ELEMENT
+#  endif
+#endif
+
+#ifdef LIGHTRAY_MTP_HAS_TYPE_PACK_ELEMENT
+        template <std::size_t I, typename... Ts>
+        using type_pack_element_t = __type_pack_element<I, Ts...>;
+#else
+        template <std::size_t I, typename... Ts>
+        using type_pack_element_t = typename decltype(
+            get<I>(type_pack_indexer<std::make_index_sequence<sizeof...(Ts)>, Ts...>{})
+        )::type;
+#endif
+
+        // The indices of the true values in Bs, in order.
+        template <bool... Bs>
+        constexpr auto true_indices() noexcept -> auto
+        {
+            constexpr bool bs[] = {Bs..., false};
+            std::array<std::size_t, (std::size_t{0} + ... + Bs)> result{};
+            for (std::size_t i = 0, j = 0; i < sizeof...(Bs); ++i)
+                if (bs[i])
+                    result[j++] = i;
+            return result;
+        }
+
+        // The indices of keys in the order which sorts keys stably.
+        template <typename Key, std::size_t N>
+        constexpr auto stable_order(const std::array<Key, N>& keys) noexcept -> std::array<std::size_t, N>
+        {
+            std::array<std::size_t, N> result{};
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                std::size_t j = i;
+                for (; j > 0 && keys[i] < keys[result[j - 1]]; --j)
+                    result[j] = result[j - 1];
+                result[j] = i;
+            }
+            return result;
+        }
+
+        // Returns type_pack_t of the types of Ts at each index in Indices.
+        template <auto Indices, typename... Ts>
+        constexpr auto type_pack_select() noexcept -> auto
+        {
+            return []<std::size_t... Js>(std::index_sequence<Js...>)
+            {
+                return type_pack_t<type_pack_element_t<Indices[Js], Ts...>...>{};
+            } (std::make_index_sequence<Indices.size()>{});
+        }
+
+    } // namespace detail
+
     template <typename T>
     concept type_pack_type = requires (T&& t)
     {
@@ -66,7 +133,61 @@ namespace lightray::mtp
          * Returns type<T> where T is the I-th type in the template parameters Ts.
          */
         template <std::size_t I>
-        static constexpr auto get() noexcept -> auto { return detail::get<I>(type_pack_t{}); }
+        requires (I < sizeof...(Ts))
+        static constexpr auto get() noexcept -> auto { return indexed_type_t<I, detail::type_pack_element_t<I, Ts...>>{}; }
+
+        /*
+         * Returns the index of the first occurrence of T in Ts, or size() if Ts does not contain T.
+         *
+         * For example:
+         *  // this returns 1
+         *  type_pack<float, int, int>.index_of<int>();
+         */
+        template <typename T>
+        static constexpr auto index_of() noexcept -> std::size_t
+        {
+            return detail::first_true_index<std::is_same_v<T, Ts>...>();
+        }
+
+        /*
+         * Returns true if Ts contains T, otherwise false.
+         */
+        template <typename T>
+        static constexpr auto contains() noexcept -> bool { return (... || std::is_same_v<T, Ts>); }
+
+        /*
+         * Returns type_pack<Us...> where Us are the types of Ts without duplicates,
+         * in the order of their first occurrences.
+         *
+         * For example:
+         *  // this returns type_pack<int, float, char>
+         *  type_pack<int, float, int, char, float>.unique();
+         */
+        static constexpr auto unique() noexcept -> auto
+        {
+            return []<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                return detail::type_pack_select<detail::true_indices<(index_of<Ts>() == Is)...>(), Ts...>();
+            } (std::index_sequence_for<Ts...>{});
+        }
+
+        /*
+         * Returns type_pack<Us...> where Us are the types of Ts from index B (inclusive)
+         * to index E (exclusive).
+         *
+         * For example:
+         *  // this returns type_pack<int, long>
+         *  type_pack<char, int, long, float>.slice<1, 3>();
+         */
+        template <std::size_t B, std::size_t E = sizeof...(Ts)>
+        requires (B <= E && E <= sizeof...(Ts))
+        static constexpr auto slice() noexcept -> auto
+        {
+            return []<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                return type_pack_t<detail::type_pack_element_t<B + Is, Ts...>...>{};
+            } (std::make_index_sequence<E - B>{});
+        }
 
         /*
          * Finds the first type in this pack which satisfies the predicate p.
@@ -94,18 +215,11 @@ namespace lightray::mtp
         requires (... && concepts::type_to_value_functor<Predicate, bool, Ts>)
         static constexpr auto find_if(Predicate&& p) noexcept -> auto
         {
-            const auto impl = [&]<auto I> (auto self, value_t<I>)
-            {
-                if constexpr (I < size())
-                {
-                    using T = typename decltype(get<I>())::type;
-                    if constexpr (decltype(std::forward<Predicate>(p).template operator()<T>())::value)
-                        return type<T>;
-                    else
-                        return self(self, value<I + 1>);
-                }
-            };
-            return impl(impl, value<0>);
+            constexpr auto index = detail::first_true_index<
+                static_cast<bool>(decltype(std::forward<Predicate>(p).template operator()<Ts>())::value)...
+            >();
+            if constexpr (index < size())
+                return type<typename decltype(get<index>())::type>;
         }
 
         /*
@@ -144,6 +258,71 @@ namespace lightray::mtp
             return (type_pack_t<>{} + ... + decide(type<Ts>));
         }
 
+        /*
+         * Splits Ts by predicate p, keeping the order of the types within each part.
+         *
+         * p must satisfy the same requirements as the predicate of filter.
+         *
+         * Returns type_pack<type_pack_t<Us...>, type_pack_t<Vs...>> where Us are the types of Ts
+         * which satisfy p, and Vs are the others.
+         *
+         * For example:
+         *  // this returns type_pack<type_pack_t<float, double>, type_pack_t<int, char>>
+         *  type_pack<float, int, double, char>.partition([]<typename T>{ return std::is_floating_point<T>{}; });
+         */
+        template <typename Predicate>
+        requires (... && concepts::type_to_value_functor<Predicate, bool, Ts>)
+        static constexpr auto partition(Predicate&& p) noexcept -> auto
+        {
+            using satisfied = decltype(detail::type_pack_select<
+                detail::true_indices<static_cast<bool>(decltype(std::forward<Predicate>(p).template operator()<Ts>())::value)...>(),
+                Ts...
+            >());
+            using unsatisfied = decltype(detail::type_pack_select<
+                detail::true_indices<!static_cast<bool>(decltype(std::forward<Predicate>(p).template operator()<Ts>())::value)...>(),
+                Ts...
+            >());
+            return type_pack_t<satisfied, unsatisfied>{};
+        }
+
+        /*
+         * Sorts Ts stably by the key of each type.
+         *
+         * key must be a functor with the following signature:
+         *  template <typename T> [return-type] operator()
+         *
+         * Additionally, key must return a value whose type have a nested constexpr static member data
+         * 'value', and the values for all T in Ts must have a common type ordered by operator<.
+         *
+         * Each key is computed once, so that sorting instantiates key sizeof...(Ts) times only,
+         * rather than a comparison for each pair of types.
+         *
+         * This function is intended to be used with C++20's template lambda.
+         * For example:
+         *  // this returns type_pack<char, short, int, double>, i.e. from the least aligned
+         *  type_pack<int, char, double, short>.sort([]<typename T>{ return value<alignof(T)>; });
+         *
+         *  // this returns type_pack<double, int, short, char>, i.e. a layout without padding
+         *  type_pack<int, char, double, short>.sort([]<typename T>{ return value<-alignof(T)>; });
+         */
+        template <typename Key>
+        requires (... && concepts::type_functor<Key, Ts>)
+        static constexpr auto sort(Key&& key) noexcept -> auto
+        {
+            if constexpr (sizeof...(Ts) == 0)
+                return type_pack_t{};
+            else
+            {
+                using key_type = std::common_type_t<
+                    std::remove_cv_t<decltype(decltype(std::forward<Key>(key).template operator()<Ts>())::value)>...
+                >;
+                constexpr auto order = detail::stable_order(std::array<key_type, sizeof...(Ts)>{
+                    static_cast<key_type>(decltype(std::forward<Key>(key).template operator()<Ts>())::value)...
+                });
+                return detail::type_pack_select<order, Ts...>();
+            }
+        }
+
         /*
          * Performs a flattening operation on template parameters Ts.
          *
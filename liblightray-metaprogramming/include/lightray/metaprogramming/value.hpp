@@ -1,11 +1,28 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 
 #include <lightray/metaprogramming/concepts/functor.hpp>
 
 namespace lightray::mtp
 {
+    namespace detail
+    {
+        /*
+         * Returns the index of the first true in Bs, or sizeof...(Bs) if there is none.
+         * Computed by a single fold, so that searching a pack costs no recursive instantiation.
+         */
+        template <bool... Bs>
+        constexpr auto first_true_index() noexcept -> std::size_t
+        {
+            std::size_t i = 0;
+            (void)(... || (Bs || (++i, false)));
+            return i;
+        }
+
+    } // namespace detail
+
     /*
      * An empty meta type holding a compile-time constant as its non-type template parameter.
      * This type is cheaply and trivially (default|copy|move) (constructible|assignable),
@@ -102,17 +102,11 @@ namespace lightray::mtp
         requires (... && concepts::value_to_value_functor<Predicate, bool, Vs>)
         static constexpr auto find_if(Predicate&& p) noexcept -> auto
         {
-            const auto impl = [&]<auto I>(auto self, value_t<I>)
-            {
-                if constexpr (I < size())
-                {
-                    if constexpr (decltype(std::forward<Predicate>(p).template operator()<get<I>()>())::value)
-                        return get<I, wrapped>();
-                    else
-                        return self(self, value<I + 1>);
-                }
-            };
-            return impl(impl, value<0>);
+            constexpr auto index = detail::first_true_index<
+                static_cast<bool>(decltype(std::forward<Predicate>(p).template operator()<Vs>())::value)...
+            >();
+            if constexpr (index < size())
+                return get<index, wrapped>();
         }
 
         /*
@@ -200,6 +194,23 @@ namespace lightray::mtp
             (std::forward<Fn>(fn).template operator()<Vs>(), ...);
         }
 
+        /*
+         * Same as for_each, but the calls to fn may run concurrently on the executor.
+         *
+         * executor must provide execute(fns...), which calls each of fns once and returns
+         * when all of them have finished (see work_stealing_executor and inline_executor).
+         * The calls are handed to the executor in the order of Vs, and fn is shared by all of them.
+         *
+         * For example:
+         *  work_stealing_executor executor;
+         *  type_info_<T>.data_members().parallel_for_each(executor, [&]<auto M>{ process(M.invoke(obj)); });
+         */
+        template <typename Executor, typename Fn> requires (... && concepts::value_functor<Fn&, Vs>)
+        static auto parallel_for_each(Executor& executor, Fn&& fn) -> void
+        {
+            executor.execute([&fn]{ fn.template operator()<Vs>(); }...);
+        }
+
         /*
          * Calls fn on the non-type template parameter pack Vs.
          *
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lightray::mtp
+{
+    /*
+     * Executor which runs every function on the calling thread, in order.
+     */
+    struct inline_executor
+    {
+        template <typename... Fns>
+        auto execute(Fns&&... fns) const -> void
+        {
+            (std::forward<Fns>(fns)(), ...);
+        }
+
+    }; // struct inline_executor
+
+    /*
+     * A fixed-size thread pool for fork-join parallelism.
+     *
+     * execute(fns...) runs each of fns once, possibly concurrently, and returns once all of them
+     * have finished. If any of them throws, the first exception is rethrown from execute after
+     * the others have finished.
+     *
+     * Each worker thread owns a queue of tasks. It takes the newest task from the back of its own
+     * queue, whose data is the most likely to still be in its cache, and when its own queue is
+     * empty, steals the oldest task from the front of another worker's queue. The tasks of one
+     * call to execute are queued in reverse, so that each worker runs those it is given in the
+     * order they were given to execute, e.g. the most expensive first (see refl::by_cost_hint).
+     *
+     * The calling thread runs tasks while it waits, which allows execute to be nested inside
+     * a task without deadlocking, and sleeps when there is none left to run.
+     */
+    class work_stealing_executor
+    {
+    private:
+        struct task_group
+        {
+            std::atomic<std::size_t> pending;
+            std::mutex error_mutex;
+            std::exception_ptr error;
+
+            explicit task_group(std::size_t task_count) noexcept
+            :   pending(task_count)
+            {}
+
+        }; // struct task_group
+
+        struct task
+        {
+            void (*run)(void*);
+            void* fn;
+            task_group* group;
+
+        }; // struct task
+
+        struct task_queue
+        {
+            std::mutex mutex;
+            std::deque<task> tasks;
+
+        }; // struct task_queue
+
+        std::vector<std::unique_ptr<task_queue>> _queues;
+        std::atomic<std::size_t> _queued = 0;
+        std::atomic<std::size_t> _next_queue = 0;
+        std::mutex _sleep_mutex;
+        std::condition_variable _wake;
+        bool _stopping = false;
+        std::vector<std::thread> _threads;
+
+        static inline thread_local const work_stealing_executor* t_executor = nullptr;
+        static inline thread_local std::size_t t_queue_index = 0;
+
+        auto run_task(const task& t) noexcept -> void
+        {
+            try
+            {
+                t.run(t.fn);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(t.group->error_mutex);
+                if (!t.group->error)
+                    t.group->error = std::current_exception();
+            }
+
+            // The group may be destroyed as soon as pending is 0, so it must not be touched after.
+            if (t.group->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                { std::lock_guard lock(_sleep_mutex); }
+                _wake.notify_all();
+            }
+        }
+
+        // Index of the queue owned by the calling thread, or of a queue to start looking from.
+        auto home_queue() noexcept -> std::size_t
+        {
+            if (t_executor == this)
+                return t_queue_index;
+            return _next_queue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+        }
+
+        auto push(std::span<const task> tasks) -> void
+        {
+            if (t_executor == this)
+            {
+                auto& queue = *_queues[t_queue_index];
+                std::lock_guard lock(queue.mutex);
+                queue.tasks.insert(queue.tasks.end(), tasks.rbegin(), tasks.rend());
+            }
+            else
+            {
+                const auto first = _next_queue.fetch_add(tasks.size(), std::memory_order_relaxed);
+                for (std::size_t i = tasks.size(); i-- != 0;)
+                {
+                    auto& queue = *_queues[(first + i) % _queues.size()];
+                    std::lock_guard lock(queue.mutex);
+                    queue.tasks.push_back(tasks[i]);
+                }
+            }
+
+            _queued.fetch_add(tasks.size(), std::memory_order_release);
+            { std::lock_guard lock(_sleep_mutex); }
+            _wake.notify_all();
+        }
+
+        // Runs one task from the queue at home, or stolen from another queue.
+        // Returns false if every queue was empty.
+        auto try_run_one(std::size_t home) -> bool
+        {
+            const bool owner = t_executor == this;
+            for (std::size_t i = 0; i < _queues.size(); ++i)
+            {
+                auto& queue = *_queues[(home + i) % _queues.size()];
+
+                std::unique_lock lock(queue.mutex);
+                if (queue.tasks.empty())
+                    continue;
+
+                task t;
+                if (owner && i == 0)
+                {
+                    t = queue.tasks.back();
+                    queue.tasks.pop_back();
+                }
+                else
+                {
+                    t = queue.tasks.front();
+                    queue.tasks.pop_front();
+                }
+                lock.unlock();
+
+                _queued.fetch_sub(1, std::memory_order_relaxed);
+                run_task(t);
+                return true;
+            }
+            return false;
+        }
+
+        auto worker_loop(std::size_t index) -> void
+        {
+            t_executor = this;
+            t_queue_index = index;
+
+            while (true)
+            {
+                if (try_run_one(index))
+                    continue;
+
+                std::unique_lock lock(_sleep_mutex);
+                _wake.wait(lock, [&] { return _stopping || _queued.load(std::memory_order_acquire) != 0; });
+                if (_stopping)
+                    return;
+            }
+        }
+
+    public:
+        /*
+         * Starts thread_count worker threads. The default leaves one hardware thread
+         * for the thread calling execute, which takes part in running tasks.
+         */
+        explicit work_stealing_executor(
+            std::size_t thread_count = std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1
+        )
+        {
+            thread_count = std::max<std::size_t>(thread_count, 1);
+
+            _queues.reserve(thread_count);
+            for (std::size_t i = 0; i < thread_count; ++i)
+                _queues.push_back(std::make_unique<task_queue>());
+
+            _threads.reserve(thread_count);
+            for (std::size_t i = 0; i < thread_count; ++i)
+                _threads.emplace_back([this, i] { worker_loop(i); });
+        }
+
+        work_stealing_executor(const work_stealing_executor&) = delete;
+        auto operator=(const work_stealing_executor&) -> work_stealing_executor& = delete;
+
+        ~work_stealing_executor()
+        {
+            {
+                std::lock_guard lock(_sleep_mutex);
+                _stopping = true;
+            }
+            _wake.notify_all();
+
+            for (auto& thread : _threads)
+                thread.join();
+        }
+
+        auto thread_count() const noexcept -> std::size_t
+        {
+            return _threads.size();
+        }
+
+        template <typename... Fns>
+        auto execute(Fns&&... fns) -> void
+        {
+            if constexpr (sizeof...(Fns) != 0)
+            {
+                task_group group(sizeof...(Fns));
+                const std::array<task, sizeof...(Fns)> tasks{task{
+                    [](void* fn) { (*static_cast<std::remove_reference_t<Fns>*>(fn))(); },
+                    const_cast<void*>(static_cast<const volatile void*>(std::addressof(fns))),
+                    &group
+                }...};
+
+                push(tasks);
+
+                const auto home = home_queue();
+                while (group.pending.load(std::memory_order_acquire) != 0)
+                {
+                    if (try_run_one(home))
+                        continue;
+
+                    // Every queue is empty, so the rest of the group is running on other threads.
+                    std::unique_lock lock(_sleep_mutex);
+                    _wake.wait(lock, [&] {
+                        return group.pending.load(std::memory_order_acquire) == 0
+                            || _queued.load(std::memory_order_acquire) != 0;
+                    });
+                }
+
+                if (group.error)
+                    std::rethrow_exception(group.error);
+            }
+        }
+
+    }; // class work_stealing_executor
+
+} // namespace lightray::mtp
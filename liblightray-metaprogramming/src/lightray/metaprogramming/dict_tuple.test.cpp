@@ -0,0 +1,88 @@
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <lightray/metaprogramming/dict_tuple.hpp>
+#include <lightray/metaprogramming/fixed_string.hpp>
+
+
+
+using namespace lightray::mtp;
+
+constexpr auto name = fixed_string("name");
+constexpr auto id = fixed_string("id");
+constexpr auto weight = fixed_string("weight");
+
+using record = indexed_dict_tuple<value_pack_t<name, id, weight>, type_pack_t<std::string, int, double>>;
+using scores = indexed_dict_tuple<value_pack_t<1, 2, 3>, type_pack_t<int, int, int>>;
+
+// Keys of different types, looked up by value.
+static_assert(std::is_same_v<record::element_type<name>, std::string>);
+static_assert(std::is_same_v<record::element_type<weight>, double>);
+static_assert(record::size() == 3);
+
+// Elements of a single type are stored in a flat std::array.
+static_assert(sizeof(scores) == sizeof(std::array<int, 3>));
+static_assert(std::is_trivially_copyable_v<scores>);
+
+// Keyed, in any order, with the other elements defaulted.
+static_assert([] {
+    const scores s(value_pack<3, 1>, 30, 10);
+    return s.get<1>() == 10 && s.get<2>() == 0 && s.get<3>() == 30;
+} ());
+
+// In key order, either every element or the first few.
+static_assert([] {
+    const scores all(1, 2, 3);
+    const scores first(7);
+    return all.get<3>() == 3 && first.get<1>() == 7 && first.get<2>() == 0 && first.get<3>() == 0;
+} ());
+
+static_assert([] {
+    scores s{};
+    s.get<2>() = 5;
+    return s.get<1>() == 0 && s.get<2>() == 5 && std::move(s).get<2>() == 5;
+} ());
+
+// Deduced from the keys and the values.
+static_assert(std::is_same_v<
+    decltype(indexed_dict_tuple(value_pack<1, 2>, 1.0, 'c')),
+    indexed_dict_tuple<value_pack_t<1, 2>, type_pack_t<double, char>>
+>);
+
+auto main() -> int
+{
+    bool ok = true;
+
+    // Keyed construction of non-trivial elements, in any order, with the other elements defaulted.
+    record r(value_pack<weight, name>, 2.5, std::string(100, 'x'));
+    ok &= r.get<name>() == std::string(100, 'x') && r.get<id>() == 0 && r.get<weight>() == 2.5;
+
+    record copy = r;
+    copy.get<name>() += 'y';
+    ok &= r.get<name>().size() == 100 && copy.get<name>().size() == 101;
+
+    record moved = std::move(copy);
+    ok &= moved.get<name>().size() == 101;
+
+    copy = moved;
+    ok &= copy.get<name>() == moved.get<name>();
+
+    // Move-only elements, both flat and in leaves.
+    using owners = indexed_dict_tuple<value_pack_t<0, 1>, type_pack_t<std::unique_ptr<int>, std::unique_ptr<int>>>;
+    owners o(std::make_unique<int>(1), std::make_unique<int>(2));
+    owners o2 = std::move(o);
+    ok &= !o.get<0>() && *o2.get<0>() == 1 && *o2.get<1>() == 2;
+
+    using mixed = indexed_dict_tuple<value_pack_t<0, 1>, type_pack_t<std::unique_ptr<int>, std::vector<int>>>;
+    mixed m(value_pack<1>, std::vector<int>{1, 2, 3});
+    m.get<0>() = std::make_unique<int>(4);
+    mixed m2 = std::move(m);
+    ok &= !m.get<0>() && *m2.get<0>() == 4 && m2.get<1>().size() == 3;
+
+    return ok ? 0 : 1;
+}
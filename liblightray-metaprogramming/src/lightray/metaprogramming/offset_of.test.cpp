@@ -0,0 +1,74 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lightray/metaprogramming/offset_of.hpp>
+
+
+
+struct packet
+{
+    std::uint8_t kind;
+    std::uint32_t length;
+    std::uint16_t checksum;
+    double payload[2];
+    char tail;
+
+}; // struct packet
+
+// Not standard-layout, as its members have different access.
+class mixed_access
+{
+    std::uint16_t _id;
+
+public:
+    double value;
+    std::uint8_t flags;
+
+    static constexpr auto id_pointer() noexcept { return &mixed_access::_id; }
+
+}; // class mixed_access
+
+struct base
+{
+    std::uint32_t base_value;
+
+}; // struct base
+
+struct derived : base
+{
+    std::uint8_t derived_value;
+    std::uint64_t wide_value;
+
+}; // struct derived
+
+using namespace lightray::mtp;
+
+static_assert(offset_of<&packet::kind> == offsetof(packet, kind));
+static_assert(offset_of<&packet::length> == offsetof(packet, length));
+static_assert(offset_of<&packet::tail> == offsetof(packet, tail));
+
+static_assert(
+    offsets_of<packet>(&packet::kind, &packet::length, &packet::checksum, &packet::payload, &packet::tail)
+ == std::array<std::ptrdiff_t, 5>{
+        offsetof(packet, kind), offsetof(packet, length), offsetof(packet, checksum),
+        offsetof(packet, payload), offsetof(packet, tail)
+    }
+);
+
+static_assert(offsets_of<packet>() == std::array<std::ptrdiff_t, 0>{});
+static_assert(offsets_of<mixed_access>(mixed_access::id_pointer(), &mixed_access::value, &mixed_access::flags)
+           == std::array<std::ptrdiff_t, 3>{0, 8, 16});
+
+// Members declared by a base are found through the object of the derived type.
+static_assert(offsets_of<derived>(&derived::base_value, &derived::derived_value, &derived::wide_value)
+           == std::array<std::ptrdiff_t, 3>{0, 4, 8});
+
+auto main() -> int
+{
+    const bool ok =
+        runtime_offset_of(&packet::checksum) == static_cast<std::ptrdiff_t>(offsetof(packet, checksum))
+     && runtime_offset_of(&mixed_access::flags) == offsets_of<mixed_access>(&mixed_access::flags)[0];
+
+    return ok ? 0 : 1;
+}
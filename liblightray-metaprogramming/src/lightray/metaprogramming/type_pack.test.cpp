@@ -0,0 +1,70 @@
+#include <cstddef>
+#include <type_traits>
+
+#include <lightray/metaprogramming/type_pack.hpp>
+#include <lightray/metaprogramming/value.hpp>
+
+
+
+using namespace lightray::mtp;
+
+constexpr auto is_floating = []<typename T>{ return std::is_floating_point<T>{}; };
+constexpr auto by_size = []<typename T>{ return value<sizeof(T)>; };
+
+// index_of is the first occurrence, or size() if there is none.
+static_assert(type_pack<float, int, int>.index_of<int>() == 1);
+static_assert(type_pack<float, int, int>.index_of<float>() == 0);
+static_assert(type_pack<float, int, int>.index_of<char>() == 3);
+static_assert(type_pack<>.index_of<int>() == 0);
+
+static_assert(type_pack<float, int, int>.contains<int>());
+static_assert(!type_pack<float, int, int>.contains<const int>());
+static_assert(!type_pack<>.contains<int>());
+
+// find_if returns the first type which satisfies the predicate, and void if none does.
+static_assert(std::is_same_v<decltype(type_pack<int, float, double>.find_if(is_floating))::type, float>);
+static_assert(std::is_void_v<decltype(type_pack<int, char>.find_if(is_floating))>);
+static_assert(std::is_void_v<decltype(type_pack<>.find_if(is_floating))>);
+
+// Duplicates are removed, keeping the first occurrence of each type in place.
+static_assert(std::is_same_v<decltype(type_pack<int, float, int, char, float>.unique()), type_pack_t<int, float, char>>);
+static_assert(std::is_same_v<decltype(type_pack<int, int, int>.unique()), type_pack_t<int>>);
+static_assert(std::is_same_v<decltype(type_pack<int, const int, int&>.unique()), type_pack_t<int, const int, int&>>);
+static_assert(std::is_same_v<decltype(type_pack<>.unique()), type_pack_t<>>);
+
+static_assert(std::is_same_v<decltype(type_pack<char, int, long, float>.slice<1, 3>()), type_pack_t<int, long>>);
+static_assert(std::is_same_v<decltype(type_pack<char, int, long, float>.slice<2>()), type_pack_t<long, float>>);
+static_assert(std::is_same_v<decltype(type_pack<char, int, long, float>.slice<4>()), type_pack_t<>>);
+static_assert(std::is_same_v<decltype(type_pack<>.slice<0, 0>()), type_pack_t<>>);
+
+// Each part keeps the order of its types in the pack.
+static_assert(std::is_same_v<
+    decltype(type_pack<float, int, double, char, long double>.partition(is_floating)),
+    type_pack_t<type_pack_t<float, double, long double>, type_pack_t<int, char>>
+>);
+static_assert(std::is_same_v<
+    decltype(type_pack<int, char>.partition(is_floating)),
+    type_pack_t<type_pack_t<>, type_pack_t<int, char>>
+>);
+static_assert(std::is_same_v<decltype(type_pack<>.partition(is_floating)), type_pack_t<type_pack_t<>, type_pack_t<>>>);
+
+// Types with equal keys keep their order in the pack.
+static_assert(std::is_same_v<
+    decltype(type_pack<int, char, float, short, unsigned char, unsigned>.sort(by_size)),
+    type_pack_t<char, unsigned char, short, int, float, unsigned>
+>);
+static_assert(std::is_same_v<
+    decltype(type_pack<float, int, unsigned>.sort(by_size)),
+    type_pack_t<float, int, unsigned>
+>);
+static_assert(std::is_same_v<
+    decltype(type_pack<int, char, double, short>.sort([]<typename T>{ return value<-static_cast<int>(alignof(T))>; })),
+    type_pack_t<double, int, short, char>
+>);
+static_assert(std::is_same_v<decltype(type_pack<int>.sort(by_size)), type_pack_t<int>>);
+static_assert(std::is_same_v<decltype(type_pack<>.sort(by_size)), type_pack_t<>>);
+
+auto main() -> int
+{
+    return 0;
+}
@@ -0,0 +1,21 @@
+#include <type_traits>
+
+#include <lightray/metaprogramming/value.hpp>
+#include <lightray/metaprogramming/value_pack.hpp>
+
+
+
+using namespace lightray::mtp;
+
+constexpr auto is_even = []<auto V>{ return value<V % 2 == 0>; };
+
+// find_if returns the first value which satisfies the predicate, and void if none does.
+static_assert(value_pack<1, 3, 5, 7, 8, 9, 10>.find_if(is_even) == 8);
+static_assert(std::is_same_v<decltype(value_pack<1, 3, 4>.find_if<true>(is_even)), indexed_value_t<2, 4>>);
+static_assert(std::is_void_v<decltype(value_pack<1, 3, 5>.find_if(is_even))>);
+static_assert(std::is_void_v<decltype(value_pack<>.find_if(is_even))>);
+
+auto main() -> int
+{
+    return 0;
+}
@@ -2,10 +2,11 @@
 #define _LIGHTRAY_PREPROCESSOR_SEQ_FOR_EACH_HPP_
 
 #include <lightray/preprocessor/common.hpp>
-#include <lightray/preprocessor/arithmetic/inc.hpp>
+#include <lightray/preprocessor/logical/if.hpp>
+#include <lightray/preprocessor/logical/is_empty.hpp>
 #include "elem.hpp"
+#include "group.hpp"
 #include "rest_n.hpp"
-#include "size.hpp"
 
 
 /*
@@ -13,269 +14,152 @@
  * where i is the index of the current element, and seq_elem is the current 
  * element with its bracket intact.
  *
+ * seq may have up to 10000 elements. It is split into three levels of groups of 10
+ * (see LIGHTRAY_PP_SEQ_GROUP), which are iterated by nested loops of at most 10 steps,
+ * each contributing one decimal digit of i. Hence the expansion depth does not grow with
+ * the size of seq, and seq is copied a constant number of times per element rather than
+ * once per preceding element.
+ *
  * Author: P. Lutchanont
  */
-#define LIGHTRAY_PP_SEQ_FOR_EACH(macro, data, seq) LIGHTRAY_PP_SEQ_FOR_EACH_EXPAND(LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_, LIGHTRAY_PP_SEQ_SIZE(seq))(macro, data, 0, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH(macro, data, seq) \
+    LIGHTRAY_PP_SEQ_FOR_EACH_EXPAND(LIGHTRAY_PP_SEQ_FOR_EACH_L3_0( \
+        macro, data, , LIGHTRAY_PP_SEQ_GROUP(LIGHTRAY_PP_SEQ_GROUP(LIGHTRAY_PP_SEQ_GROUP(seq))) \
+    ))
 #define LIGHTRAY_PP_SEQ_FOR_EACH_EXPAND(...) __VA_ARGS__
 
 
-#define LIGHTRAY_PP_SEQ_FOR_EACH_0(macro, data, i, seq)
-#define LIGHTRAY_PP_SEQ_FOR_EACH_1(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_0(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_2(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_1(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_3(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_2(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_4(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_3(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_5(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_4(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_6(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_5(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_7(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_6(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_8(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_7(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_9(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_8(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_10(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_9(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_11(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_10(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_12(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_11(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_13(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_12(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_14(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_13(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_15(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_14(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_16(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_15(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_17(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_16(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_18(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_17(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_19(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_18(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_20(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_19(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_21(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_20(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_22(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_21(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_23(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_22(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_24(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_23(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_25(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_24(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_26(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_25(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_27(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_26(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_28(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_27(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_29(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_28(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_30(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_29(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_31(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_30(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_32(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_31(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_33(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_32(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_34(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_33(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_35(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_34(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_36(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_35(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_37(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_36(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_38(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_37(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_39(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_38(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_40(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_39(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_41(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_40(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_42(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_41(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_43(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_42(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_44(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_43(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_45(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_44(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_46(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_45(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_47(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_46(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_48(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_47(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_49(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_48(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_50(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_49(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_51(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_50(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_52(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_51(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_53(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_52(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_54(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_53(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_55(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_54(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_56(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_55(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_57(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_56(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_58(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_57(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_59(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_58(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_60(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_59(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_61(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_60(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_62(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_61(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_63(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_62(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_64(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_63(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_65(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_64(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_66(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_65(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_67(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_66(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_68(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_67(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_69(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_68(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_70(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_69(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_71(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_70(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_72(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_71(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_73(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_72(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_74(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_73(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_75(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_74(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_76(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_75(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_77(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_76(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_78(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_77(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_79(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_78(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_80(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_79(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_81(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_80(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_82(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_81(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_83(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_82(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_84(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_83(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_85(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_84(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_86(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_85(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_87(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_86(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_88(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_87(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_89(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_88(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_90(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_89(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_91(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_90(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_92(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_91(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_93(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_92(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_94(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_93(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_95(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_94(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_96(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_95(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_97(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_96(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_98(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_97(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_99(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_98(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_100(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_99(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_101(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_100(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_102(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_101(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_103(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_102(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_104(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_103(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_105(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_104(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_106(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_105(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_107(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_106(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_108(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_107(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_109(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_108(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_110(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_109(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_111(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_110(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_112(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_111(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_113(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_112(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_114(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_113(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_115(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_114(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_116(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_115(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_117(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_116(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_118(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_117(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_119(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_118(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_120(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_119(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_121(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_120(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_122(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_121(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_123(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_122(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_124(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_123(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_125(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_124(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_126(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_125(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_127(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_126(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_128(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_127(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_129(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_128(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_130(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_129(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_131(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_130(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_132(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_131(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_133(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_132(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_134(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_133(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_135(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_134(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_136(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_135(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_137(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_136(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_138(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_137(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_139(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_138(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_140(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_139(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_141(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_140(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_142(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_141(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_143(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_142(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_144(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_143(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_145(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_144(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_146(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_145(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_147(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_146(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_148(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_147(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_149(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_148(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_150(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_149(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_151(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_150(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_152(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_151(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_153(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_152(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_154(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_153(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_155(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_154(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_156(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_155(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_157(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_156(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_158(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_157(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_159(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_158(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_160(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_159(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_161(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_160(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_162(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_161(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_163(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_162(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_164(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_163(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_165(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_164(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_166(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_165(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_167(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_166(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_168(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_167(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_169(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_168(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_170(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_169(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_171(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_170(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_172(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_171(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_173(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_172(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_174(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_173(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_175(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_174(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_176(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_175(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_177(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_176(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_178(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_177(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_179(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_178(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_180(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_179(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_181(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_180(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_182(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_181(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_183(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_182(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_184(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_183(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_185(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_184(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_186(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_185(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_187(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_186(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_188(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_187(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_189(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_188(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_190(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_189(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_191(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_190(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_192(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_191(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_193(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_192(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_194(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_193(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_195(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_194(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_196(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_195(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_197(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_196(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_198(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_197(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_199(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_198(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_200(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_199(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_201(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_200(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_202(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_201(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_203(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_202(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_204(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_203(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_205(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_204(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_206(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_205(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_207(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_206(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_208(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_207(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_209(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_208(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_210(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_209(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_211(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_210(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_212(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_211(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_213(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_212(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_214(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_213(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_215(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_214(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_216(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_215(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_217(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_216(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_218(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_217(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_219(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_218(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_220(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_219(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_221(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_220(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_222(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_221(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_223(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_222(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_224(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_223(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_225(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_224(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_226(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_225(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_227(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_226(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_228(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_227(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_229(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_228(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_230(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_229(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_231(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_230(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_232(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_231(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_233(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_232(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_234(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_233(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_235(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_234(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_236(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_235(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_237(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_236(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_238(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_237(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_239(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_238(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_240(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_239(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_241(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_240(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_242(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_241(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_243(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_242(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_244(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_243(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_245(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_244(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_246(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_245(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_247(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_246(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_248(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_247(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_249(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_248(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_250(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_249(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_251(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_250(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_252(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_251(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_253(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_252(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_254(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_253(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_255(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_254(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
-#define LIGHTRAY_PP_SEQ_FOR_EACH_256(macro, data, i, seq) LIGHTRAY_PP_DEFER(macro)(data, i, LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_255(macro, data, LIGHTRAY_PP_INC(i), LIGHTRAY_PP_SEQ_REST_N(1, seq))
+// Level 3: iterates over the groups of 1000 elements, prefix holds the digits of i above the thousands.
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_0(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_0_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_1(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_1_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_2(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_2_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_3(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_3_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_4(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_4_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_5(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_5_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_6(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_6_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_7(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_7_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_8(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_8_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_9(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L3_9_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_0_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 0), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_1(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_1_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 1), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_2(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_2_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 2), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_3(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_3_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 3), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_4(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_4_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 4), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_5(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_5_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 5), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_6(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_6_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 6), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_7(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_7_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 7), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_8(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_8_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 8), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_9(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_9_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 9), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L3_10(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_0_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_1_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_2_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_3_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_4_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_5_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_6_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_7_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_8_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_9_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L3_10(macro, data, prefix, seq) LIGHTRAY_PP_IF(LIGHTRAY_PP_IS_EMPTY(seq), , LIGHTRAY_PP_SEQ_FOR_EACH_ERROR_more_than_10000_elements)
+
+// Level 2: iterates over the groups of 100 elements, prefix holds the digits of i above the hundreds.
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_0(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_0_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_1(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_1_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_2(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_2_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_3(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_3_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_4(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_4_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_5(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_5_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_6(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_6_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_7(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_7_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_8(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_8_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_9(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L2_9_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_0_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 0), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_1(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_1_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 1), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_2(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_2_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 2), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_3(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_3_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 3), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_4(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_4_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 4), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_5(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_5_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 5), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_6(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_6_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 6), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_7(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_7_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 7), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_8(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_8_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 8), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_9(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_9_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 9), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L2_10(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_0_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_1_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_2_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_3_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_4_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_5_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_6_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_7_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_8_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_9_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L2_10(macro, data, prefix, seq)
+
+// Level 1: iterates over the groups of 10 elements, prefix holds the digits of i above the tens.
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_0(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_0_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_1(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_1_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_2(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_2_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_3(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_3_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_4(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_4_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_5(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_5_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_6(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_6_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_7(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_7_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_8(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_8_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_9(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L1_9_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_0_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 0), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_1(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_1_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 1), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_2(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_2_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 2), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_3(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_3_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 3), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_4(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_4_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 4), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_5(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_5_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 5), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_6(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_6_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 6), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_7(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_7_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 7), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_8(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_8_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 8), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_9(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_9_0(macro, data, prefix, seq) LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, 9), LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(0, seq))) LIGHTRAY_PP_SEQ_FOR_EACH_L1_10(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_0_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_1_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_2_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_3_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_4_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_5_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_6_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_7_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_8_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_9_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L1_10(macro, data, prefix, seq)
+
+// Level 0: iterates over the elements of a group, prefix holds the digits of i above the ones.
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_0(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_0_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_1(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_1_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_2(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_2_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_3(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_3_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_4(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_4_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_5(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_5_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_6(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_6_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_7(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_7_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_8(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_8_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_9(macro, data, prefix, seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_FOR_EACH_L0_9_, LIGHTRAY_PP_IS_EMPTY(seq))(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_0_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 0), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_1(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_1_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 1), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_2(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_2_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 2), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_3(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_3_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 3), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_4(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_4_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 4), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_5(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_5_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 5), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_6(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_6_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 6), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_7(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_7_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 7), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_8(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_8_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 8), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_9(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_9_0(macro, data, prefix, seq) LIGHTRAY_PP_DEFER(macro)(data, LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, 9), LIGHTRAY_PP_SEQ_ELEM(0, seq)) LIGHTRAY_PP_SEQ_FOR_EACH_L0_10(macro, data, prefix, LIGHTRAY_PP_SEQ_REST_N(1, seq))
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_0_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_1_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_2_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_3_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_4_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_5_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_6_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_7_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_8_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_9_1(macro, data, prefix, seq)
+#define LIGHTRAY_PP_SEQ_FOR_EACH_L0_10(macro, data, prefix, seq)
 
 
 #endif
@@ -0,0 +1,110 @@
+#ifndef _LIGHTRAY_PREPROCESSOR_SEQ_GROUP_HPP_
+#define _LIGHTRAY_PREPROCESSOR_SEQ_GROUP_HPP_
+
+#include <lightray/preprocessor/common.hpp>
+#include <lightray/preprocessor/logical/is_empty.hpp>
+
+
+/*
+ * Splits seq into a seq of groups of (up to) 10 consecutive elements, each group being
+ * itself a seq. For example:
+ *
+ *  LIGHTRAY_PP_SEQ_GROUP((a)(b)(c)...(k)(l)) expands to ((a)(b)(c)...(j)) ((k)(l))
+ *
+ * seq is walked in a single pass of constant depth, regardless of its size, so that
+ * macros iterating over long seqs can do so through a few levels of short groups
+ * instead of a chain as long as the seq.
+ *
+ * Author: P. Lutchanont
+ */
+#define LIGHTRAY_PP_SEQ_GROUP(seq) LIGHTRAY_PP_SEQ_GROUP_I(LIGHTRAY_PP_SEQ_GROUP_WRAP(seq))
+
+// Each element is wrapped in another bracket first, so that an empty element ()
+// is not mistaken for the empty element terminating the walk.
+#define LIGHTRAY_PP_SEQ_GROUP_I(wrapped_seq) LIGHTRAY_PP_SEQ_GROUP_0 wrapped_seq ()
+
+#define LIGHTRAY_PP_SEQ_GROUP_WRAP(seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_WRAP_A seq, _END)
+#define LIGHTRAY_PP_SEQ_GROUP_WRAP_A(...) ((__VA_ARGS__)) LIGHTRAY_PP_SEQ_GROUP_WRAP_B
+#define LIGHTRAY_PP_SEQ_GROUP_WRAP_B(...) ((__VA_ARGS__)) LIGHTRAY_PP_SEQ_GROUP_WRAP_A
+#define LIGHTRAY_PP_SEQ_GROUP_WRAP_A_END
+#define LIGHTRAY_PP_SEQ_GROUP_WRAP_B_END
+
+
+#define LIGHTRAY_PP_SEQ_GROUP_0(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_0_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_1(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_1_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_2(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_2_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_3(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_3_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_4(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_4_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_5(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_5_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_6(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_6_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_7(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_7_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_8(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_8_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_9(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_9_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define LIGHTRAY_PP_SEQ_GROUP_B(...) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_B_, LIGHTRAY_PP_IS_EMPTY(__VA_ARGS__))(__VA_ARGS__)
+
+#define LIGHTRAY_PP_SEQ_GROUP_0_0(...) ( __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_1
+#define LIGHTRAY_PP_SEQ_GROUP_1_0(...) __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_2
+#define LIGHTRAY_PP_SEQ_GROUP_2_0(...) __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_3
+#define LIGHTRAY_PP_SEQ_GROUP_3_0(...) __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_4
+#define LIGHTRAY_PP_SEQ_GROUP_4_0(...) __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_5
+#define LIGHTRAY_PP_SEQ_GROUP_5_0(...) __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_6
+#define LIGHTRAY_PP_SEQ_GROUP_6_0(...) __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_7
+#define LIGHTRAY_PP_SEQ_GROUP_7_0(...) __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_8
+#define LIGHTRAY_PP_SEQ_GROUP_8_0(...) __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_9
+#define LIGHTRAY_PP_SEQ_GROUP_9_0(...) __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_B
+#define LIGHTRAY_PP_SEQ_GROUP_B_0(...) ) ( __VA_ARGS__ LIGHTRAY_PP_SEQ_GROUP_1
+
+#define LIGHTRAY_PP_SEQ_GROUP_0_1(...)
+#define LIGHTRAY_PP_SEQ_GROUP_1_1(...) )
+#define LIGHTRAY_PP_SEQ_GROUP_2_1(...) )
+#define LIGHTRAY_PP_SEQ_GROUP_3_1(...) )
+#define LIGHTRAY_PP_SEQ_GROUP_4_1(...) )
+#define LIGHTRAY_PP_SEQ_GROUP_5_1(...) )
+#define LIGHTRAY_PP_SEQ_GROUP_6_1(...) )
+#define LIGHTRAY_PP_SEQ_GROUP_7_1(...) )
+#define LIGHTRAY_PP_SEQ_GROUP_8_1(...) )
+#define LIGHTRAY_PP_SEQ_GROUP_9_1(...) )
+#define LIGHTRAY_PP_SEQ_GROUP_B_1(...) )
+
+
+/*
+ * Expands to the elements of the group elem, i.e. removes the bracket of elem.
+ *
+ * Author: P. Lutchanont
+ */
+#define LIGHTRAY_PP_SEQ_GROUP_UNWRAP(elem) LIGHTRAY_PP_SEQ_GROUP_UNWRAP_I elem
+#define LIGHTRAY_PP_SEQ_GROUP_UNWRAP_I(...) __VA_ARGS__
+
+
+/*
+ * Appends the decimal digit d to the number prefix, which may be empty. A leading zero
+ * (i.e. d being 0 while prefix is empty) is dropped, so that an index can be formed digit
+ * by digit from the positions of its groups, e.g. (, 0) -> empty, (, 4) -> 4, (4, 0) -> 40.
+ *
+ * Author: P. Lutchanont
+ */
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT(prefix, d) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_DIGIT_, LIGHTRAY_PP_IS_EMPTY(prefix))(prefix, d)
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_0(prefix, d) prefix ## d
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_1(prefix, d) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_, d)
+
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_0
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_1 1
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_2 2
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_3 3
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_4 4
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_5 5
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_6 6
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_7 7
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_8 8
+#define LIGHTRAY_PP_SEQ_GROUP_DIGIT_LEADING_9 9
+
+/*
+ * Same as LIGHTRAY_PP_SEQ_GROUP_DIGIT, but keeps d even if it is a leading zero.
+ * Used for the last digit of a number.
+ *
+ * Author: P. Lutchanont
+ */
+#define LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT(prefix, d) LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT_I(prefix, d)
+#define LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT_I(prefix, d) prefix ## d
+
+#endif
@@ -2,13 +2,69 @@
 #define _LIGHTRAY_PREPROCESSOR_SEQ_SIZE_HPP_
 
 #include <lightray/preprocessor/common.hpp>
+#include <lightray/preprocessor/arithmetic/dec.hpp>
+#include <lightray/preprocessor/arithmetic/inc.hpp>
+#include <lightray/preprocessor/logical/is_empty.hpp>
+#include "elem.hpp"
+#include "group.hpp"
 
 /*
  * Expands to the number of elements in seq.
  *
+ * seq may have up to 10000 elements. Like LIGHTRAY_PP_SEQ_FOR_EACH, seq is split into
+ * three levels of groups of 10, and only the last group of each level is counted:
+ * their sizes minus one are the digits of the index of the last element.
+ *
  * Author: P. Lutchanont
  */
-#define LIGHTRAY_PP_SEQ_SIZE(seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_SIZE_0 seq, _LIGHTRAY_PP_SEQ_SIZE_GET)
+#define LIGHTRAY_PP_SEQ_SIZE(seq) \
+    LIGHTRAY_PP_SEQ_SIZE_I(LIGHTRAY_PP_SEQ_GROUP(LIGHTRAY_PP_SEQ_GROUP(LIGHTRAY_PP_SEQ_GROUP(seq))))
+
+#define LIGHTRAY_PP_SEQ_SIZE_I(seq3) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_SIZE_I_, LIGHTRAY_PP_IS_EMPTY(seq3))(seq3)
+#define LIGHTRAY_PP_SEQ_SIZE_I_1(seq3) 0
+#define LIGHTRAY_PP_SEQ_SIZE_I_0(seq3) LIGHTRAY_PP_SEQ_SIZE_A(LIGHTRAY_PP_SEQ_SIZE_LAST_INDEX(seq3), seq3)
+
+#define LIGHTRAY_PP_SEQ_SIZE_A(a, seq3) LIGHTRAY_PP_SEQ_SIZE_A_I(a, LIGHTRAY_PP_SEQ_SIZE_LAST(a, seq3))
+#define LIGHTRAY_PP_SEQ_SIZE_A_I(a, seq2) LIGHTRAY_PP_SEQ_SIZE_B(a, LIGHTRAY_PP_SEQ_SIZE_LAST_INDEX(seq2), seq2)
+#define LIGHTRAY_PP_SEQ_SIZE_B(a, b, seq2) LIGHTRAY_PP_SEQ_SIZE_B_I(a, b, LIGHTRAY_PP_SEQ_SIZE_LAST(b, seq2))
+#define LIGHTRAY_PP_SEQ_SIZE_B_I(a, b, seq1) LIGHTRAY_PP_SEQ_SIZE_C(a, b, LIGHTRAY_PP_SEQ_SIZE_LAST_INDEX(seq1), seq1)
+#define LIGHTRAY_PP_SEQ_SIZE_C(a, b, c, seq1) LIGHTRAY_PP_SEQ_SIZE_C_I(a, b, c, LIGHTRAY_PP_SEQ_SIZE_LAST(c, seq1))
+#define LIGHTRAY_PP_SEQ_SIZE_C_I(a, b, c, seq0) LIGHTRAY_PP_SEQ_SIZE_NEXT(a, b, c, LIGHTRAY_PP_SEQ_SIZE_LAST_INDEX(seq0))
+
+#define LIGHTRAY_PP_SEQ_SIZE_LAST(i, group_seq) LIGHTRAY_PP_SEQ_GROUP_UNWRAP(LIGHTRAY_PP_SEQ_ELEM(i, group_seq))
+#define LIGHTRAY_PP_SEQ_SIZE_LAST_INDEX(seq) LIGHTRAY_PP_DEC(LIGHTRAY_PP_SEQ_SIZE_SMALL(seq))
+
+// Expands to the number after the one with the digits a b c d.
+#define LIGHTRAY_PP_SEQ_SIZE_NEXT(a, b, c, d) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_SIZE_NEXT_D_, LIGHTRAY_PP_SEQ_SIZE_IS_9(d))(a, b, c, d)
+#define LIGHTRAY_PP_SEQ_SIZE_NEXT_D_0(a, b, c, d) LIGHTRAY_PP_SEQ_SIZE_NUMBER(a, b, c, LIGHTRAY_PP_INC(d))
+#define LIGHTRAY_PP_SEQ_SIZE_NEXT_D_1(a, b, c, d) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_SIZE_NEXT_C_, LIGHTRAY_PP_SEQ_SIZE_IS_9(c))(a, b, c)
+#define LIGHTRAY_PP_SEQ_SIZE_NEXT_C_0(a, b, c) LIGHTRAY_PP_SEQ_SIZE_NUMBER(a, b, LIGHTRAY_PP_INC(c), 0)
+#define LIGHTRAY_PP_SEQ_SIZE_NEXT_C_1(a, b, c) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_SIZE_NEXT_B_, LIGHTRAY_PP_SEQ_SIZE_IS_9(b))(a, b)
+#define LIGHTRAY_PP_SEQ_SIZE_NEXT_B_0(a, b) LIGHTRAY_PP_SEQ_SIZE_NUMBER(a, LIGHTRAY_PP_INC(b), 0, 0)
+#define LIGHTRAY_PP_SEQ_SIZE_NEXT_B_1(a, b) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_SIZE_NEXT_A_, LIGHTRAY_PP_SEQ_SIZE_IS_9(a))(a)
+#define LIGHTRAY_PP_SEQ_SIZE_NEXT_A_0(a) LIGHTRAY_PP_SEQ_SIZE_NUMBER(LIGHTRAY_PP_INC(a), 0, 0, 0)
+#define LIGHTRAY_PP_SEQ_SIZE_NEXT_A_1(a) 10000
+
+#define LIGHTRAY_PP_SEQ_SIZE_NUMBER(a, b, c, d) \
+    LIGHTRAY_PP_SEQ_GROUP_LAST_DIGIT( \
+        LIGHTRAY_PP_SEQ_GROUP_DIGIT(LIGHTRAY_PP_SEQ_GROUP_DIGIT(LIGHTRAY_PP_SEQ_GROUP_DIGIT(, a), b), c), d \
+    )
+
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9(d) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_SIZE_IS_9_, d)
+
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_0 0
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_1 0
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_2 0
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_3 0
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_4 0
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_5 0
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_6 0
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_7 0
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_8 0
+#define LIGHTRAY_PP_SEQ_SIZE_IS_9_9 1
+
+// Counts the elements of a seq of at most 10 elements, i.e. of a group.
+#define LIGHTRAY_PP_SEQ_SIZE_SMALL(seq) LIGHTRAY_PP_CAT(LIGHTRAY_PP_SEQ_SIZE_0 seq, _LIGHTRAY_PP_SEQ_SIZE_GET)
 
 #define LIGHTRAY_PP_SEQ_SIZE_0(...) LIGHTRAY_PP_SEQ_SIZE_1
 #define LIGHTRAY_PP_SEQ_SIZE_1(...) LIGHTRAY_PP_SEQ_SIZE_2
@@ -20,253 +76,6 @@
 #define LIGHTRAY_PP_SEQ_SIZE_7(...) LIGHTRAY_PP_SEQ_SIZE_8
 #define LIGHTRAY_PP_SEQ_SIZE_8(...) LIGHTRAY_PP_SEQ_SIZE_9
 #define LIGHTRAY_PP_SEQ_SIZE_9(...) LIGHTRAY_PP_SEQ_SIZE_10
-#define LIGHTRAY_PP_SEQ_SIZE_10(...) LIGHTRAY_PP_SEQ_SIZE_11
-#define LIGHTRAY_PP_SEQ_SIZE_11(...) LIGHTRAY_PP_SEQ_SIZE_12
-#define LIGHTRAY_PP_SEQ_SIZE_12(...) LIGHTRAY_PP_SEQ_SIZE_13
-#define LIGHTRAY_PP_SEQ_SIZE_13(...) LIGHTRAY_PP_SEQ_SIZE_14
-#define LIGHTRAY_PP_SEQ_SIZE_14(...) LIGHTRAY_PP_SEQ_SIZE_15
-#define LIGHTRAY_PP_SEQ_SIZE_15(...) LIGHTRAY_PP_SEQ_SIZE_16
-#define LIGHTRAY_PP_SEQ_SIZE_16(...) LIGHTRAY_PP_SEQ_SIZE_17
-#define LIGHTRAY_PP_SEQ_SIZE_17(...) LIGHTRAY_PP_SEQ_SIZE_18
-#define LIGHTRAY_PP_SEQ_SIZE_18(...) LIGHTRAY_PP_SEQ_SIZE_19
-#define LIGHTRAY_PP_SEQ_SIZE_19(...) LIGHTRAY_PP_SEQ_SIZE_20
-#define LIGHTRAY_PP_SEQ_SIZE_20(...) LIGHTRAY_PP_SEQ_SIZE_21
-#define LIGHTRAY_PP_SEQ_SIZE_21(...) LIGHTRAY_PP_SEQ_SIZE_22
-#define LIGHTRAY_PP_SEQ_SIZE_22(...) LIGHTRAY_PP_SEQ_SIZE_23
-#define LIGHTRAY_PP_SEQ_SIZE_23(...) LIGHTRAY_PP_SEQ_SIZE_24
-#define LIGHTRAY_PP_SEQ_SIZE_24(...) LIGHTRAY_PP_SEQ_SIZE_25
-#define LIGHTRAY_PP_SEQ_SIZE_25(...) LIGHTRAY_PP_SEQ_SIZE_26
-#define LIGHTRAY_PP_SEQ_SIZE_26(...) LIGHTRAY_PP_SEQ_SIZE_27
-#define LIGHTRAY_PP_SEQ_SIZE_27(...) LIGHTRAY_PP_SEQ_SIZE_28
-#define LIGHTRAY_PP_SEQ_SIZE_28(...) LIGHTRAY_PP_SEQ_SIZE_29
-#define LIGHTRAY_PP_SEQ_SIZE_29(...) LIGHTRAY_PP_SEQ_SIZE_30
-#define LIGHTRAY_PP_SEQ_SIZE_30(...) LIGHTRAY_PP_SEQ_SIZE_31
-#define LIGHTRAY_PP_SEQ_SIZE_31(...) LIGHTRAY_PP_SEQ_SIZE_32
-#define LIGHTRAY_PP_SEQ_SIZE_32(...) LIGHTRAY_PP_SEQ_SIZE_33
-#define LIGHTRAY_PP_SEQ_SIZE_33(...) LIGHTRAY_PP_SEQ_SIZE_34
-#define LIGHTRAY_PP_SEQ_SIZE_34(...) LIGHTRAY_PP_SEQ_SIZE_35
-#define LIGHTRAY_PP_SEQ_SIZE_35(...) LIGHTRAY_PP_SEQ_SIZE_36
-#define LIGHTRAY_PP_SEQ_SIZE_36(...) LIGHTRAY_PP_SEQ_SIZE_37
-#define LIGHTRAY_PP_SEQ_SIZE_37(...) LIGHTRAY_PP_SEQ_SIZE_38
-#define LIGHTRAY_PP_SEQ_SIZE_38(...) LIGHTRAY_PP_SEQ_SIZE_39
-#define LIGHTRAY_PP_SEQ_SIZE_39(...) LIGHTRAY_PP_SEQ_SIZE_40
-#define LIGHTRAY_PP_SEQ_SIZE_40(...) LIGHTRAY_PP_SEQ_SIZE_41
-#define LIGHTRAY_PP_SEQ_SIZE_41(...) LIGHTRAY_PP_SEQ_SIZE_42
-#define LIGHTRAY_PP_SEQ_SIZE_42(...) LIGHTRAY_PP_SEQ_SIZE_43
-#define LIGHTRAY_PP_SEQ_SIZE_43(...) LIGHTRAY_PP_SEQ_SIZE_44
-#define LIGHTRAY_PP_SEQ_SIZE_44(...) LIGHTRAY_PP_SEQ_SIZE_45
-#define LIGHTRAY_PP_SEQ_SIZE_45(...) LIGHTRAY_PP_SEQ_SIZE_46
-#define LIGHTRAY_PP_SEQ_SIZE_46(...) LIGHTRAY_PP_SEQ_SIZE_47
-#define LIGHTRAY_PP_SEQ_SIZE_47(...) LIGHTRAY_PP_SEQ_SIZE_48
-#define LIGHTRAY_PP_SEQ_SIZE_48(...) LIGHTRAY_PP_SEQ_SIZE_49
-#define LIGHTRAY_PP_SEQ_SIZE_49(...) LIGHTRAY_PP_SEQ_SIZE_50
-#define LIGHTRAY_PP_SEQ_SIZE_50(...) LIGHTRAY_PP_SEQ_SIZE_51
-#define LIGHTRAY_PP_SEQ_SIZE_51(...) LIGHTRAY_PP_SEQ_SIZE_52
-#define LIGHTRAY_PP_SEQ_SIZE_52(...) LIGHTRAY_PP_SEQ_SIZE_53
-#define LIGHTRAY_PP_SEQ_SIZE_53(...) LIGHTRAY_PP_SEQ_SIZE_54
-#define LIGHTRAY_PP_SEQ_SIZE_54(...) LIGHTRAY_PP_SEQ_SIZE_55
-#define LIGHTRAY_PP_SEQ_SIZE_55(...) LIGHTRAY_PP_SEQ_SIZE_56
-#define LIGHTRAY_PP_SEQ_SIZE_56(...) LIGHTRAY_PP_SEQ_SIZE_57
-#define LIGHTRAY_PP_SEQ_SIZE_57(...) LIGHTRAY_PP_SEQ_SIZE_58
-#define LIGHTRAY_PP_SEQ_SIZE_58(...) LIGHTRAY_PP_SEQ_SIZE_59
-#define LIGHTRAY_PP_SEQ_SIZE_59(...) LIGHTRAY_PP_SEQ_SIZE_60
-#define LIGHTRAY_PP_SEQ_SIZE_60(...) LIGHTRAY_PP_SEQ_SIZE_61
-#define LIGHTRAY_PP_SEQ_SIZE_61(...) LIGHTRAY_PP_SEQ_SIZE_62
-#define LIGHTRAY_PP_SEQ_SIZE_62(...) LIGHTRAY_PP_SEQ_SIZE_63
-#define LIGHTRAY_PP_SEQ_SIZE_63(...) LIGHTRAY_PP_SEQ_SIZE_64
-#define LIGHTRAY_PP_SEQ_SIZE_64(...) LIGHTRAY_PP_SEQ_SIZE_65
-#define LIGHTRAY_PP_SEQ_SIZE_65(...) LIGHTRAY_PP_SEQ_SIZE_66
-#define LIGHTRAY_PP_SEQ_SIZE_66(...) LIGHTRAY_PP_SEQ_SIZE_67
-#define LIGHTRAY_PP_SEQ_SIZE_67(...) LIGHTRAY_PP_SEQ_SIZE_68
-#define LIGHTRAY_PP_SEQ_SIZE_68(...) LIGHTRAY_PP_SEQ_SIZE_69
-#define LIGHTRAY_PP_SEQ_SIZE_69(...) LIGHTRAY_PP_SEQ_SIZE_70
-#define LIGHTRAY_PP_SEQ_SIZE_70(...) LIGHTRAY_PP_SEQ_SIZE_71
-#define LIGHTRAY_PP_SEQ_SIZE_71(...) LIGHTRAY_PP_SEQ_SIZE_72
-#define LIGHTRAY_PP_SEQ_SIZE_72(...) LIGHTRAY_PP_SEQ_SIZE_73
-#define LIGHTRAY_PP_SEQ_SIZE_73(...) LIGHTRAY_PP_SEQ_SIZE_74
-#define LIGHTRAY_PP_SEQ_SIZE_74(...) LIGHTRAY_PP_SEQ_SIZE_75
-#define LIGHTRAY_PP_SEQ_SIZE_75(...) LIGHTRAY_PP_SEQ_SIZE_76
-#define LIGHTRAY_PP_SEQ_SIZE_76(...) LIGHTRAY_PP_SEQ_SIZE_77
-#define LIGHTRAY_PP_SEQ_SIZE_77(...) LIGHTRAY_PP_SEQ_SIZE_78
-#define LIGHTRAY_PP_SEQ_SIZE_78(...) LIGHTRAY_PP_SEQ_SIZE_79
-#define LIGHTRAY_PP_SEQ_SIZE_79(...) LIGHTRAY_PP_SEQ_SIZE_80
-#define LIGHTRAY_PP_SEQ_SIZE_80(...) LIGHTRAY_PP_SEQ_SIZE_81
-#define LIGHTRAY_PP_SEQ_SIZE_81(...) LIGHTRAY_PP_SEQ_SIZE_82
-#define LIGHTRAY_PP_SEQ_SIZE_82(...) LIGHTRAY_PP_SEQ_SIZE_83
-#define LIGHTRAY_PP_SEQ_SIZE_83(...) LIGHTRAY_PP_SEQ_SIZE_84
-#define LIGHTRAY_PP_SEQ_SIZE_84(...) LIGHTRAY_PP_SEQ_SIZE_85
-#define LIGHTRAY_PP_SEQ_SIZE_85(...) LIGHTRAY_PP_SEQ_SIZE_86
-#define LIGHTRAY_PP_SEQ_SIZE_86(...) LIGHTRAY_PP_SEQ_SIZE_87
-#define LIGHTRAY_PP_SEQ_SIZE_87(...) LIGHTRAY_PP_SEQ_SIZE_88
-#define LIGHTRAY_PP_SEQ_SIZE_88(...) LIGHTRAY_PP_SEQ_SIZE_89
-#define LIGHTRAY_PP_SEQ_SIZE_89(...) LIGHTRAY_PP_SEQ_SIZE_90
-#define LIGHTRAY_PP_SEQ_SIZE_90(...) LIGHTRAY_PP_SEQ_SIZE_91
-#define LIGHTRAY_PP_SEQ_SIZE_91(...) LIGHTRAY_PP_SEQ_SIZE_92
-#define LIGHTRAY_PP_SEQ_SIZE_92(...) LIGHTRAY_PP_SEQ_SIZE_93
-#define LIGHTRAY_PP_SEQ_SIZE_93(...) LIGHTRAY_PP_SEQ_SIZE_94
-#define LIGHTRAY_PP_SEQ_SIZE_94(...) LIGHTRAY_PP_SEQ_SIZE_95
-#define LIGHTRAY_PP_SEQ_SIZE_95(...) LIGHTRAY_PP_SEQ_SIZE_96
-#define LIGHTRAY_PP_SEQ_SIZE_96(...) LIGHTRAY_PP_SEQ_SIZE_97
-#define LIGHTRAY_PP_SEQ_SIZE_97(...) LIGHTRAY_PP_SEQ_SIZE_98
-#define LIGHTRAY_PP_SEQ_SIZE_98(...) LIGHTRAY_PP_SEQ_SIZE_99
-#define LIGHTRAY_PP_SEQ_SIZE_99(...) LIGHTRAY_PP_SEQ_SIZE_100
-#define LIGHTRAY_PP_SEQ_SIZE_100(...) LIGHTRAY_PP_SEQ_SIZE_101
-#define LIGHTRAY_PP_SEQ_SIZE_101(...) LIGHTRAY_PP_SEQ_SIZE_102
-#define LIGHTRAY_PP_SEQ_SIZE_102(...) LIGHTRAY_PP_SEQ_SIZE_103
-#define LIGHTRAY_PP_SEQ_SIZE_103(...) LIGHTRAY_PP_SEQ_SIZE_104
-#define LIGHTRAY_PP_SEQ_SIZE_104(...) LIGHTRAY_PP_SEQ_SIZE_105
-#define LIGHTRAY_PP_SEQ_SIZE_105(...) LIGHTRAY_PP_SEQ_SIZE_106
-#define LIGHTRAY_PP_SEQ_SIZE_106(...) LIGHTRAY_PP_SEQ_SIZE_107
-#define LIGHTRAY_PP_SEQ_SIZE_107(...) LIGHTRAY_PP_SEQ_SIZE_108
-#define LIGHTRAY_PP_SEQ_SIZE_108(...) LIGHTRAY_PP_SEQ_SIZE_109
-#define LIGHTRAY_PP_SEQ_SIZE_109(...) LIGHTRAY_PP_SEQ_SIZE_110
-#define LIGHTRAY_PP_SEQ_SIZE_110(...) LIGHTRAY_PP_SEQ_SIZE_111
-#define LIGHTRAY_PP_SEQ_SIZE_111(...) LIGHTRAY_PP_SEQ_SIZE_112
-#define LIGHTRAY_PP_SEQ_SIZE_112(...) LIGHTRAY_PP_SEQ_SIZE_113
-#define LIGHTRAY_PP_SEQ_SIZE_113(...) LIGHTRAY_PP_SEQ_SIZE_114
-#define LIGHTRAY_PP_SEQ_SIZE_114(...) LIGHTRAY_PP_SEQ_SIZE_115
-#define LIGHTRAY_PP_SEQ_SIZE_115(...) LIGHTRAY_PP_SEQ_SIZE_116
-#define LIGHTRAY_PP_SEQ_SIZE_116(...) LIGHTRAY_PP_SEQ_SIZE_117
-#define LIGHTRAY_PP_SEQ_SIZE_117(...) LIGHTRAY_PP_SEQ_SIZE_118
-#define LIGHTRAY_PP_SEQ_SIZE_118(...) LIGHTRAY_PP_SEQ_SIZE_119
-#define LIGHTRAY_PP_SEQ_SIZE_119(...) LIGHTRAY_PP_SEQ_SIZE_120
-#define LIGHTRAY_PP_SEQ_SIZE_120(...) LIGHTRAY_PP_SEQ_SIZE_121
-#define LIGHTRAY_PP_SEQ_SIZE_121(...) LIGHTRAY_PP_SEQ_SIZE_122
-#define LIGHTRAY_PP_SEQ_SIZE_122(...) LIGHTRAY_PP_SEQ_SIZE_123
-#define LIGHTRAY_PP_SEQ_SIZE_123(...) LIGHTRAY_PP_SEQ_SIZE_124
-#define LIGHTRAY_PP_SEQ_SIZE_124(...) LIGHTRAY_PP_SEQ_SIZE_125
-#define LIGHTRAY_PP_SEQ_SIZE_125(...) LIGHTRAY_PP_SEQ_SIZE_126
-#define LIGHTRAY_PP_SEQ_SIZE_126(...) LIGHTRAY_PP_SEQ_SIZE_127
-#define LIGHTRAY_PP_SEQ_SIZE_127(...) LIGHTRAY_PP_SEQ_SIZE_128
-#define LIGHTRAY_PP_SEQ_SIZE_128(...) LIGHTRAY_PP_SEQ_SIZE_129
-#define LIGHTRAY_PP_SEQ_SIZE_129(...) LIGHTRAY_PP_SEQ_SIZE_130
-#define LIGHTRAY_PP_SEQ_SIZE_130(...) LIGHTRAY_PP_SEQ_SIZE_131
-#define LIGHTRAY_PP_SEQ_SIZE_131(...) LIGHTRAY_PP_SEQ_SIZE_132
-#define LIGHTRAY_PP_SEQ_SIZE_132(...) LIGHTRAY_PP_SEQ_SIZE_133
-#define LIGHTRAY_PP_SEQ_SIZE_133(...) LIGHTRAY_PP_SEQ_SIZE_134
-#define LIGHTRAY_PP_SEQ_SIZE_134(...) LIGHTRAY_PP_SEQ_SIZE_135
-#define LIGHTRAY_PP_SEQ_SIZE_135(...) LIGHTRAY_PP_SEQ_SIZE_136
-#define LIGHTRAY_PP_SEQ_SIZE_136(...) LIGHTRAY_PP_SEQ_SIZE_137
-#define LIGHTRAY_PP_SEQ_SIZE_137(...) LIGHTRAY_PP_SEQ_SIZE_138
-#define LIGHTRAY_PP_SEQ_SIZE_138(...) LIGHTRAY_PP_SEQ_SIZE_139
-#define LIGHTRAY_PP_SEQ_SIZE_139(...) LIGHTRAY_PP_SEQ_SIZE_140
-#define LIGHTRAY_PP_SEQ_SIZE_140(...) LIGHTRAY_PP_SEQ_SIZE_141
-#define LIGHTRAY_PP_SEQ_SIZE_141(...) LIGHTRAY_PP_SEQ_SIZE_142
-#define LIGHTRAY_PP_SEQ_SIZE_142(...) LIGHTRAY_PP_SEQ_SIZE_143
-#define LIGHTRAY_PP_SEQ_SIZE_143(...) LIGHTRAY_PP_SEQ_SIZE_144
-#define LIGHTRAY_PP_SEQ_SIZE_144(...) LIGHTRAY_PP_SEQ_SIZE_145
-#define LIGHTRAY_PP_SEQ_SIZE_145(...) LIGHTRAY_PP_SEQ_SIZE_146
-#define LIGHTRAY_PP_SEQ_SIZE_146(...) LIGHTRAY_PP_SEQ_SIZE_147
-#define LIGHTRAY_PP_SEQ_SIZE_147(...) LIGHTRAY_PP_SEQ_SIZE_148
-#define LIGHTRAY_PP_SEQ_SIZE_148(...) LIGHTRAY_PP_SEQ_SIZE_149
-#define LIGHTRAY_PP_SEQ_SIZE_149(...) LIGHTRAY_PP_SEQ_SIZE_150
-#define LIGHTRAY_PP_SEQ_SIZE_150(...) LIGHTRAY_PP_SEQ_SIZE_151
-#define LIGHTRAY_PP_SEQ_SIZE_151(...) LIGHTRAY_PP_SEQ_SIZE_152
-#define LIGHTRAY_PP_SEQ_SIZE_152(...) LIGHTRAY_PP_SEQ_SIZE_153
-#define LIGHTRAY_PP_SEQ_SIZE_153(...) LIGHTRAY_PP_SEQ_SIZE_154
-#define LIGHTRAY_PP_SEQ_SIZE_154(...) LIGHTRAY_PP_SEQ_SIZE_155
-#define LIGHTRAY_PP_SEQ_SIZE_155(...) LIGHTRAY_PP_SEQ_SIZE_156
-#define LIGHTRAY_PP_SEQ_SIZE_156(...) LIGHTRAY_PP_SEQ_SIZE_157
-#define LIGHTRAY_PP_SEQ_SIZE_157(...) LIGHTRAY_PP_SEQ_SIZE_158
-#define LIGHTRAY_PP_SEQ_SIZE_158(...) LIGHTRAY_PP_SEQ_SIZE_159
-#define LIGHTRAY_PP_SEQ_SIZE_159(...) LIGHTRAY_PP_SEQ_SIZE_160
-#define LIGHTRAY_PP_SEQ_SIZE_160(...) LIGHTRAY_PP_SEQ_SIZE_161
-#define LIGHTRAY_PP_SEQ_SIZE_161(...) LIGHTRAY_PP_SEQ_SIZE_162
-#define LIGHTRAY_PP_SEQ_SIZE_162(...) LIGHTRAY_PP_SEQ_SIZE_163
-#define LIGHTRAY_PP_SEQ_SIZE_163(...) LIGHTRAY_PP_SEQ_SIZE_164
-#define LIGHTRAY_PP_SEQ_SIZE_164(...) LIGHTRAY_PP_SEQ_SIZE_165
-#define LIGHTRAY_PP_SEQ_SIZE_165(...) LIGHTRAY_PP_SEQ_SIZE_166
-#define LIGHTRAY_PP_SEQ_SIZE_166(...) LIGHTRAY_PP_SEQ_SIZE_167
-#define LIGHTRAY_PP_SEQ_SIZE_167(...) LIGHTRAY_PP_SEQ_SIZE_168
-#define LIGHTRAY_PP_SEQ_SIZE_168(...) LIGHTRAY_PP_SEQ_SIZE_169
-#define LIGHTRAY_PP_SEQ_SIZE_169(...) LIGHTRAY_PP_SEQ_SIZE_170
-#define LIGHTRAY_PP_SEQ_SIZE_170(...) LIGHTRAY_PP_SEQ_SIZE_171
-#define LIGHTRAY_PP_SEQ_SIZE_171(...) LIGHTRAY_PP_SEQ_SIZE_172
-#define LIGHTRAY_PP_SEQ_SIZE_172(...) LIGHTRAY_PP_SEQ_SIZE_173
-#define LIGHTRAY_PP_SEQ_SIZE_173(...) LIGHTRAY_PP_SEQ_SIZE_174
-#define LIGHTRAY_PP_SEQ_SIZE_174(...) LIGHTRAY_PP_SEQ_SIZE_175
-#define LIGHTRAY_PP_SEQ_SIZE_175(...) LIGHTRAY_PP_SEQ_SIZE_176
-#define LIGHTRAY_PP_SEQ_SIZE_176(...) LIGHTRAY_PP_SEQ_SIZE_177
-#define LIGHTRAY_PP_SEQ_SIZE_177(...) LIGHTRAY_PP_SEQ_SIZE_178
-#define LIGHTRAY_PP_SEQ_SIZE_178(...) LIGHTRAY_PP_SEQ_SIZE_179
-#define LIGHTRAY_PP_SEQ_SIZE_179(...) LIGHTRAY_PP_SEQ_SIZE_180
-#define LIGHTRAY_PP_SEQ_SIZE_180(...) LIGHTRAY_PP_SEQ_SIZE_181
-#define LIGHTRAY_PP_SEQ_SIZE_181(...) LIGHTRAY_PP_SEQ_SIZE_182
-#define LIGHTRAY_PP_SEQ_SIZE_182(...) LIGHTRAY_PP_SEQ_SIZE_183
-#define LIGHTRAY_PP_SEQ_SIZE_183(...) LIGHTRAY_PP_SEQ_SIZE_184
-#define LIGHTRAY_PP_SEQ_SIZE_184(...) LIGHTRAY_PP_SEQ_SIZE_185
-#define LIGHTRAY_PP_SEQ_SIZE_185(...) LIGHTRAY_PP_SEQ_SIZE_186
-#define LIGHTRAY_PP_SEQ_SIZE_186(...) LIGHTRAY_PP_SEQ_SIZE_187
-#define LIGHTRAY_PP_SEQ_SIZE_187(...) LIGHTRAY_PP_SEQ_SIZE_188
-#define LIGHTRAY_PP_SEQ_SIZE_188(...) LIGHTRAY_PP_SEQ_SIZE_189
-#define LIGHTRAY_PP_SEQ_SIZE_189(...) LIGHTRAY_PP_SEQ_SIZE_190
-#define LIGHTRAY_PP_SEQ_SIZE_190(...) LIGHTRAY_PP_SEQ_SIZE_191
-#define LIGHTRAY_PP_SEQ_SIZE_191(...) LIGHTRAY_PP_SEQ_SIZE_192
-#define LIGHTRAY_PP_SEQ_SIZE_192(...) LIGHTRAY_PP_SEQ_SIZE_193
-#define LIGHTRAY_PP_SEQ_SIZE_193(...) LIGHTRAY_PP_SEQ_SIZE_194
-#define LIGHTRAY_PP_SEQ_SIZE_194(...) LIGHTRAY_PP_SEQ_SIZE_195
-#define LIGHTRAY_PP_SEQ_SIZE_195(...) LIGHTRAY_PP_SEQ_SIZE_196
-#define LIGHTRAY_PP_SEQ_SIZE_196(...) LIGHTRAY_PP_SEQ_SIZE_197
-#define LIGHTRAY_PP_SEQ_SIZE_197(...) LIGHTRAY_PP_SEQ_SIZE_198
-#define LIGHTRAY_PP_SEQ_SIZE_198(...) LIGHTRAY_PP_SEQ_SIZE_199
-#define LIGHTRAY_PP_SEQ_SIZE_199(...) LIGHTRAY_PP_SEQ_SIZE_200
-#define LIGHTRAY_PP_SEQ_SIZE_200(...) LIGHTRAY_PP_SEQ_SIZE_201
-#define LIGHTRAY_PP_SEQ_SIZE_201(...) LIGHTRAY_PP_SEQ_SIZE_202
-#define LIGHTRAY_PP_SEQ_SIZE_202(...) LIGHTRAY_PP_SEQ_SIZE_203
-#define LIGHTRAY_PP_SEQ_SIZE_203(...) LIGHTRAY_PP_SEQ_SIZE_204
-#define LIGHTRAY_PP_SEQ_SIZE_204(...) LIGHTRAY_PP_SEQ_SIZE_205
-#define LIGHTRAY_PP_SEQ_SIZE_205(...) LIGHTRAY_PP_SEQ_SIZE_206
-#define LIGHTRAY_PP_SEQ_SIZE_206(...) LIGHTRAY_PP_SEQ_SIZE_207
-#define LIGHTRAY_PP_SEQ_SIZE_207(...) LIGHTRAY_PP_SEQ_SIZE_208
-#define LIGHTRAY_PP_SEQ_SIZE_208(...) LIGHTRAY_PP_SEQ_SIZE_209
-#define LIGHTRAY_PP_SEQ_SIZE_209(...) LIGHTRAY_PP_SEQ_SIZE_210
-#define LIGHTRAY_PP_SEQ_SIZE_210(...) LIGHTRAY_PP_SEQ_SIZE_211
-#define LIGHTRAY_PP_SEQ_SIZE_211(...) LIGHTRAY_PP_SEQ_SIZE_212
-#define LIGHTRAY_PP_SEQ_SIZE_212(...) LIGHTRAY_PP_SEQ_SIZE_213
-#define LIGHTRAY_PP_SEQ_SIZE_213(...) LIGHTRAY_PP_SEQ_SIZE_214
-#define LIGHTRAY_PP_SEQ_SIZE_214(...) LIGHTRAY_PP_SEQ_SIZE_215
-#define LIGHTRAY_PP_SEQ_SIZE_215(...) LIGHTRAY_PP_SEQ_SIZE_216
-#define LIGHTRAY_PP_SEQ_SIZE_216(...) LIGHTRAY_PP_SEQ_SIZE_217
-#define LIGHTRAY_PP_SEQ_SIZE_217(...) LIGHTRAY_PP_SEQ_SIZE_218
-#define LIGHTRAY_PP_SEQ_SIZE_218(...) LIGHTRAY_PP_SEQ_SIZE_219
-#define LIGHTRAY_PP_SEQ_SIZE_219(...) LIGHTRAY_PP_SEQ_SIZE_220
-#define LIGHTRAY_PP_SEQ_SIZE_220(...) LIGHTRAY_PP_SEQ_SIZE_221
-#define LIGHTRAY_PP_SEQ_SIZE_221(...) LIGHTRAY_PP_SEQ_SIZE_222
-#define LIGHTRAY_PP_SEQ_SIZE_222(...) LIGHTRAY_PP_SEQ_SIZE_223
-#define LIGHTRAY_PP_SEQ_SIZE_223(...) LIGHTRAY_PP_SEQ_SIZE_224
-#define LIGHTRAY_PP_SEQ_SIZE_224(...) LIGHTRAY_PP_SEQ_SIZE_225
-#define LIGHTRAY_PP_SEQ_SIZE_225(...) LIGHTRAY_PP_SEQ_SIZE_226
-#define LIGHTRAY_PP_SEQ_SIZE_226(...) LIGHTRAY_PP_SEQ_SIZE_227
-#define LIGHTRAY_PP_SEQ_SIZE_227(...) LIGHTRAY_PP_SEQ_SIZE_228
-#define LIGHTRAY_PP_SEQ_SIZE_228(...) LIGHTRAY_PP_SEQ_SIZE_229
-#define LIGHTRAY_PP_SEQ_SIZE_229(...) LIGHTRAY_PP_SEQ_SIZE_230
-#define LIGHTRAY_PP_SEQ_SIZE_230(...) LIGHTRAY_PP_SEQ_SIZE_231
-#define LIGHTRAY_PP_SEQ_SIZE_231(...) LIGHTRAY_PP_SEQ_SIZE_232
-#define LIGHTRAY_PP_SEQ_SIZE_232(...) LIGHTRAY_PP_SEQ_SIZE_233
-#define LIGHTRAY_PP_SEQ_SIZE_233(...) LIGHTRAY_PP_SEQ_SIZE_234
-#define LIGHTRAY_PP_SEQ_SIZE_234(...) LIGHTRAY_PP_SEQ_SIZE_235
-#define LIGHTRAY_PP_SEQ_SIZE_235(...) LIGHTRAY_PP_SEQ_SIZE_236
-#define LIGHTRAY_PP_SEQ_SIZE_236(...) LIGHTRAY_PP_SEQ_SIZE_237
-#define LIGHTRAY_PP_SEQ_SIZE_237(...) LIGHTRAY_PP_SEQ_SIZE_238
-#define LIGHTRAY_PP_SEQ_SIZE_238(...) LIGHTRAY_PP_SEQ_SIZE_239
-#define LIGHTRAY_PP_SEQ_SIZE_239(...) LIGHTRAY_PP_SEQ_SIZE_240
-#define LIGHTRAY_PP_SEQ_SIZE_240(...) LIGHTRAY_PP_SEQ_SIZE_241
-#define LIGHTRAY_PP_SEQ_SIZE_241(...) LIGHTRAY_PP_SEQ_SIZE_242
-#define LIGHTRAY_PP_SEQ_SIZE_242(...) LIGHTRAY_PP_SEQ_SIZE_243
-#define LIGHTRAY_PP_SEQ_SIZE_243(...) LIGHTRAY_PP_SEQ_SIZE_244
-#define LIGHTRAY_PP_SEQ_SIZE_244(...) LIGHTRAY_PP_SEQ_SIZE_245
-#define LIGHTRAY_PP_SEQ_SIZE_245(...) LIGHTRAY_PP_SEQ_SIZE_246
-#define LIGHTRAY_PP_SEQ_SIZE_246(...) LIGHTRAY_PP_SEQ_SIZE_247
-#define LIGHTRAY_PP_SEQ_SIZE_247(...) LIGHTRAY_PP_SEQ_SIZE_248
-#define LIGHTRAY_PP_SEQ_SIZE_248(...) LIGHTRAY_PP_SEQ_SIZE_249
-#define LIGHTRAY_PP_SEQ_SIZE_249(...) LIGHTRAY_PP_SEQ_SIZE_250
-#define LIGHTRAY_PP_SEQ_SIZE_250(...) LIGHTRAY_PP_SEQ_SIZE_251
-#define LIGHTRAY_PP_SEQ_SIZE_251(...) LIGHTRAY_PP_SEQ_SIZE_252
-#define LIGHTRAY_PP_SEQ_SIZE_252(...) LIGHTRAY_PP_SEQ_SIZE_253
-#define LIGHTRAY_PP_SEQ_SIZE_253(...) LIGHTRAY_PP_SEQ_SIZE_254
-#define LIGHTRAY_PP_SEQ_SIZE_254(...) LIGHTRAY_PP_SEQ_SIZE_255
-#define LIGHTRAY_PP_SEQ_SIZE_255(...) LIGHTRAY_PP_SEQ_SIZE_256
-
 
 #define LIGHTRAY_PP_SEQ_SIZE_0_LIGHTRAY_PP_SEQ_SIZE_GET 0
 #define LIGHTRAY_PP_SEQ_SIZE_1_LIGHTRAY_PP_SEQ_SIZE_GET 1
@@ -279,251 +88,6 @@
 #define LIGHTRAY_PP_SEQ_SIZE_8_LIGHTRAY_PP_SEQ_SIZE_GET 8
 #define LIGHTRAY_PP_SEQ_SIZE_9_LIGHTRAY_PP_SEQ_SIZE_GET 9
 #define LIGHTRAY_PP_SEQ_SIZE_10_LIGHTRAY_PP_SEQ_SIZE_GET 10
-#define LIGHTRAY_PP_SEQ_SIZE_11_LIGHTRAY_PP_SEQ_SIZE_GET 11
-#define LIGHTRAY_PP_SEQ_SIZE_12_LIGHTRAY_PP_SEQ_SIZE_GET 12
-#define LIGHTRAY_PP_SEQ_SIZE_13_LIGHTRAY_PP_SEQ_SIZE_GET 13
-#define LIGHTRAY_PP_SEQ_SIZE_14_LIGHTRAY_PP_SEQ_SIZE_GET 14
-#define LIGHTRAY_PP_SEQ_SIZE_15_LIGHTRAY_PP_SEQ_SIZE_GET 15
-#define LIGHTRAY_PP_SEQ_SIZE_16_LIGHTRAY_PP_SEQ_SIZE_GET 16
-#define LIGHTRAY_PP_SEQ_SIZE_17_LIGHTRAY_PP_SEQ_SIZE_GET 17
-#define LIGHTRAY_PP_SEQ_SIZE_18_LIGHTRAY_PP_SEQ_SIZE_GET 18
-#define LIGHTRAY_PP_SEQ_SIZE_19_LIGHTRAY_PP_SEQ_SIZE_GET 19
-#define LIGHTRAY_PP_SEQ_SIZE_20_LIGHTRAY_PP_SEQ_SIZE_GET 20
-#define LIGHTRAY_PP_SEQ_SIZE_21_LIGHTRAY_PP_SEQ_SIZE_GET 21
-#define LIGHTRAY_PP_SEQ_SIZE_22_LIGHTRAY_PP_SEQ_SIZE_GET 22
-#define LIGHTRAY_PP_SEQ_SIZE_23_LIGHTRAY_PP_SEQ_SIZE_GET 23
-#define LIGHTRAY_PP_SEQ_SIZE_24_LIGHTRAY_PP_SEQ_SIZE_GET 24
-#define LIGHTRAY_PP_SEQ_SIZE_25_LIGHTRAY_PP_SEQ_SIZE_GET 25
-#define LIGHTRAY_PP_SEQ_SIZE_26_LIGHTRAY_PP_SEQ_SIZE_GET 26
-#define LIGHTRAY_PP_SEQ_SIZE_27_LIGHTRAY_PP_SEQ_SIZE_GET 27
-#define LIGHTRAY_PP_SEQ_SIZE_28_LIGHTRAY_PP_SEQ_SIZE_GET 28
-#define LIGHTRAY_PP_SEQ_SIZE_29_LIGHTRAY_PP_SEQ_SIZE_GET 29
-#define LIGHTRAY_PP_SEQ_SIZE_30_LIGHTRAY_PP_SEQ_SIZE_GET 30
-#define LIGHTRAY_PP_SEQ_SIZE_31_LIGHTRAY_PP_SEQ_SIZE_GET 31
-#define LIGHTRAY_PP_SEQ_SIZE_32_LIGHTRAY_PP_SEQ_SIZE_GET 32
-#define LIGHTRAY_PP_SEQ_SIZE_33_LIGHTRAY_PP_SEQ_SIZE_GET 33
-#define LIGHTRAY_PP_SEQ_SIZE_34_LIGHTRAY_PP_SEQ_SIZE_GET 34
-#define LIGHTRAY_PP_SEQ_SIZE_35_LIGHTRAY_PP_SEQ_SIZE_GET 35
-#define LIGHTRAY_PP_SEQ_SIZE_36_LIGHTRAY_PP_SEQ_SIZE_GET 36
-#define LIGHTRAY_PP_SEQ_SIZE_37_LIGHTRAY_PP_SEQ_SIZE_GET 37
-#define LIGHTRAY_PP_SEQ_SIZE_38_LIGHTRAY_PP_SEQ_SIZE_GET 38
-#define LIGHTRAY_PP_SEQ_SIZE_39_LIGHTRAY_PP_SEQ_SIZE_GET 39
-#define LIGHTRAY_PP_SEQ_SIZE_40_LIGHTRAY_PP_SEQ_SIZE_GET 40
-#define LIGHTRAY_PP_SEQ_SIZE_41_LIGHTRAY_PP_SEQ_SIZE_GET 41
-#define LIGHTRAY_PP_SEQ_SIZE_42_LIGHTRAY_PP_SEQ_SIZE_GET 42
-#define LIGHTRAY_PP_SEQ_SIZE_43_LIGHTRAY_PP_SEQ_SIZE_GET 43
-#define LIGHTRAY_PP_SEQ_SIZE_44_LIGHTRAY_PP_SEQ_SIZE_GET 44
-#define LIGHTRAY_PP_SEQ_SIZE_45_LIGHTRAY_PP_SEQ_SIZE_GET 45
-#define LIGHTRAY_PP_SEQ_SIZE_46_LIGHTRAY_PP_SEQ_SIZE_GET 46
-#define LIGHTRAY_PP_SEQ_SIZE_47_LIGHTRAY_PP_SEQ_SIZE_GET 47
-#define LIGHTRAY_PP_SEQ_SIZE_48_LIGHTRAY_PP_SEQ_SIZE_GET 48
-#define LIGHTRAY_PP_SEQ_SIZE_49_LIGHTRAY_PP_SEQ_SIZE_GET 49
-#define LIGHTRAY_PP_SEQ_SIZE_50_LIGHTRAY_PP_SEQ_SIZE_GET 50
-#define LIGHTRAY_PP_SEQ_SIZE_51_LIGHTRAY_PP_SEQ_SIZE_GET 51
-#define LIGHTRAY_PP_SEQ_SIZE_52_LIGHTRAY_PP_SEQ_SIZE_GET 52
-#define LIGHTRAY_PP_SEQ_SIZE_53_LIGHTRAY_PP_SEQ_SIZE_GET 53
-#define LIGHTRAY_PP_SEQ_SIZE_54_LIGHTRAY_PP_SEQ_SIZE_GET 54
-#define LIGHTRAY_PP_SEQ_SIZE_55_LIGHTRAY_PP_SEQ_SIZE_GET 55
-#define LIGHTRAY_PP_SEQ_SIZE_56_LIGHTRAY_PP_SEQ_SIZE_GET 56
-#define LIGHTRAY_PP_SEQ_SIZE_57_LIGHTRAY_PP_SEQ_SIZE_GET 57
-#define LIGHTRAY_PP_SEQ_SIZE_58_LIGHTRAY_PP_SEQ_SIZE_GET 58
-#define LIGHTRAY_PP_SEQ_SIZE_59_LIGHTRAY_PP_SEQ_SIZE_GET 59
-#define LIGHTRAY_PP_SEQ_SIZE_60_LIGHTRAY_PP_SEQ_SIZE_GET 60
-#define LIGHTRAY_PP_SEQ_SIZE_61_LIGHTRAY_PP_SEQ_SIZE_GET 61
-#define LIGHTRAY_PP_SEQ_SIZE_62_LIGHTRAY_PP_SEQ_SIZE_GET 62
-#define LIGHTRAY_PP_SEQ_SIZE_63_LIGHTRAY_PP_SEQ_SIZE_GET 63
-#define LIGHTRAY_PP_SEQ_SIZE_64_LIGHTRAY_PP_SEQ_SIZE_GET 64
-#define LIGHTRAY_PP_SEQ_SIZE_65_LIGHTRAY_PP_SEQ_SIZE_GET 65
-#define LIGHTRAY_PP_SEQ_SIZE_66_LIGHTRAY_PP_SEQ_SIZE_GET 66
-#define LIGHTRAY_PP_SEQ_SIZE_67_LIGHTRAY_PP_SEQ_SIZE_GET 67
-#define LIGHTRAY_PP_SEQ_SIZE_68_LIGHTRAY_PP_SEQ_SIZE_GET 68
-#define LIGHTRAY_PP_SEQ_SIZE_69_LIGHTRAY_PP_SEQ_SIZE_GET 69
-#define LIGHTRAY_PP_SEQ_SIZE_70_LIGHTRAY_PP_SEQ_SIZE_GET 70
-#define LIGHTRAY_PP_SEQ_SIZE_71_LIGHTRAY_PP_SEQ_SIZE_GET 71
-#define LIGHTRAY_PP_SEQ_SIZE_72_LIGHTRAY_PP_SEQ_SIZE_GET 72
-#define LIGHTRAY_PP_SEQ_SIZE_73_LIGHTRAY_PP_SEQ_SIZE_GET 73
-#define LIGHTRAY_PP_SEQ_SIZE_74_LIGHTRAY_PP_SEQ_SIZE_GET 74
-#define LIGHTRAY_PP_SEQ_SIZE_75_LIGHTRAY_PP_SEQ_SIZE_GET 75
-#define LIGHTRAY_PP_SEQ_SIZE_76_LIGHTRAY_PP_SEQ_SIZE_GET 76
-#define LIGHTRAY_PP_SEQ_SIZE_77_LIGHTRAY_PP_SEQ_SIZE_GET 77
-#define LIGHTRAY_PP_SEQ_SIZE_78_LIGHTRAY_PP_SEQ_SIZE_GET 78
-#define LIGHTRAY_PP_SEQ_SIZE_79_LIGHTRAY_PP_SEQ_SIZE_GET 79
-#define LIGHTRAY_PP_SEQ_SIZE_80_LIGHTRAY_PP_SEQ_SIZE_GET 80
-#define LIGHTRAY_PP_SEQ_SIZE_81_LIGHTRAY_PP_SEQ_SIZE_GET 81
-#define LIGHTRAY_PP_SEQ_SIZE_82_LIGHTRAY_PP_SEQ_SIZE_GET 82
-#define LIGHTRAY_PP_SEQ_SIZE_83_LIGHTRAY_PP_SEQ_SIZE_GET 83
-#define LIGHTRAY_PP_SEQ_SIZE_84_LIGHTRAY_PP_SEQ_SIZE_GET 84
-#define LIGHTRAY_PP_SEQ_SIZE_85_LIGHTRAY_PP_SEQ_SIZE_GET 85
-#define LIGHTRAY_PP_SEQ_SIZE_86_LIGHTRAY_PP_SEQ_SIZE_GET 86
-#define LIGHTRAY_PP_SEQ_SIZE_87_LIGHTRAY_PP_SEQ_SIZE_GET 87
-#define LIGHTRAY_PP_SEQ_SIZE_88_LIGHTRAY_PP_SEQ_SIZE_GET 88
-#define LIGHTRAY_PP_SEQ_SIZE_89_LIGHTRAY_PP_SEQ_SIZE_GET 89
-#define LIGHTRAY_PP_SEQ_SIZE_90_LIGHTRAY_PP_SEQ_SIZE_GET 90
-#define LIGHTRAY_PP_SEQ_SIZE_91_LIGHTRAY_PP_SEQ_SIZE_GET 91
-#define LIGHTRAY_PP_SEQ_SIZE_92_LIGHTRAY_PP_SEQ_SIZE_GET 92
-#define LIGHTRAY_PP_SEQ_SIZE_93_LIGHTRAY_PP_SEQ_SIZE_GET 93
-#define LIGHTRAY_PP_SEQ_SIZE_94_LIGHTRAY_PP_SEQ_SIZE_GET 94
-#define LIGHTRAY_PP_SEQ_SIZE_95_LIGHTRAY_PP_SEQ_SIZE_GET 95
-#define LIGHTRAY_PP_SEQ_SIZE_96_LIGHTRAY_PP_SEQ_SIZE_GET 96
-#define LIGHTRAY_PP_SEQ_SIZE_97_LIGHTRAY_PP_SEQ_SIZE_GET 97
-#define LIGHTRAY_PP_SEQ_SIZE_98_LIGHTRAY_PP_SEQ_SIZE_GET 98
-#define LIGHTRAY_PP_SEQ_SIZE_99_LIGHTRAY_PP_SEQ_SIZE_GET 99
-#define LIGHTRAY_PP_SEQ_SIZE_100_LIGHTRAY_PP_SEQ_SIZE_GET 100
-#define LIGHTRAY_PP_SEQ_SIZE_101_LIGHTRAY_PP_SEQ_SIZE_GET 101
-#define LIGHTRAY_PP_SEQ_SIZE_102_LIGHTRAY_PP_SEQ_SIZE_GET 102
-#define LIGHTRAY_PP_SEQ_SIZE_103_LIGHTRAY_PP_SEQ_SIZE_GET 103
-#define LIGHTRAY_PP_SEQ_SIZE_104_LIGHTRAY_PP_SEQ_SIZE_GET 104
-#define LIGHTRAY_PP_SEQ_SIZE_105_LIGHTRAY_PP_SEQ_SIZE_GET 105
-#define LIGHTRAY_PP_SEQ_SIZE_106_LIGHTRAY_PP_SEQ_SIZE_GET 106
-#define LIGHTRAY_PP_SEQ_SIZE_107_LIGHTRAY_PP_SEQ_SIZE_GET 107
-#define LIGHTRAY_PP_SEQ_SIZE_108_LIGHTRAY_PP_SEQ_SIZE_GET 108
-#define LIGHTRAY_PP_SEQ_SIZE_109_LIGHTRAY_PP_SEQ_SIZE_GET 109
-#define LIGHTRAY_PP_SEQ_SIZE_110_LIGHTRAY_PP_SEQ_SIZE_GET 110
-#define LIGHTRAY_PP_SEQ_SIZE_111_LIGHTRAY_PP_SEQ_SIZE_GET 111
-#define LIGHTRAY_PP_SEQ_SIZE_112_LIGHTRAY_PP_SEQ_SIZE_GET 112
-#define LIGHTRAY_PP_SEQ_SIZE_113_LIGHTRAY_PP_SEQ_SIZE_GET 113
-#define LIGHTRAY_PP_SEQ_SIZE_114_LIGHTRAY_PP_SEQ_SIZE_GET 114
-#define LIGHTRAY_PP_SEQ_SIZE_115_LIGHTRAY_PP_SEQ_SIZE_GET 115
-#define LIGHTRAY_PP_SEQ_SIZE_116_LIGHTRAY_PP_SEQ_SIZE_GET 116
-#define LIGHTRAY_PP_SEQ_SIZE_117_LIGHTRAY_PP_SEQ_SIZE_GET 117
-#define LIGHTRAY_PP_SEQ_SIZE_118_LIGHTRAY_PP_SEQ_SIZE_GET 118
-#define LIGHTRAY_PP_SEQ_SIZE_119_LIGHTRAY_PP_SEQ_SIZE_GET 119
-#define LIGHTRAY_PP_SEQ_SIZE_120_LIGHTRAY_PP_SEQ_SIZE_GET 120
-#define LIGHTRAY_PP_SEQ_SIZE_121_LIGHTRAY_PP_SEQ_SIZE_GET 121
-#define LIGHTRAY_PP_SEQ_SIZE_122_LIGHTRAY_PP_SEQ_SIZE_GET 122
-#define LIGHTRAY_PP_SEQ_SIZE_123_LIGHTRAY_PP_SEQ_SIZE_GET 123
-#define LIGHTRAY_PP_SEQ_SIZE_124_LIGHTRAY_PP_SEQ_SIZE_GET 124
-#define LIGHTRAY_PP_SEQ_SIZE_125_LIGHTRAY_PP_SEQ_SIZE_GET 125
-#define LIGHTRAY_PP_SEQ_SIZE_126_LIGHTRAY_PP_SEQ_SIZE_GET 126
-#define LIGHTRAY_PP_SEQ_SIZE_127_LIGHTRAY_PP_SEQ_SIZE_GET 127
-#define LIGHTRAY_PP_SEQ_SIZE_128_LIGHTRAY_PP_SEQ_SIZE_GET 128
-#define LIGHTRAY_PP_SEQ_SIZE_129_LIGHTRAY_PP_SEQ_SIZE_GET 129
-#define LIGHTRAY_PP_SEQ_SIZE_130_LIGHTRAY_PP_SEQ_SIZE_GET 130
-#define LIGHTRAY_PP_SEQ_SIZE_131_LIGHTRAY_PP_SEQ_SIZE_GET 131
-#define LIGHTRAY_PP_SEQ_SIZE_132_LIGHTRAY_PP_SEQ_SIZE_GET 132
-#define LIGHTRAY_PP_SEQ_SIZE_133_LIGHTRAY_PP_SEQ_SIZE_GET 133
-#define LIGHTRAY_PP_SEQ_SIZE_134_LIGHTRAY_PP_SEQ_SIZE_GET 134
-#define LIGHTRAY_PP_SEQ_SIZE_135_LIGHTRAY_PP_SEQ_SIZE_GET 135
-#define LIGHTRAY_PP_SEQ_SIZE_136_LIGHTRAY_PP_SEQ_SIZE_GET 136
-#define LIGHTRAY_PP_SEQ_SIZE_137_LIGHTRAY_PP_SEQ_SIZE_GET 137
-#define LIGHTRAY_PP_SEQ_SIZE_138_LIGHTRAY_PP_SEQ_SIZE_GET 138
-#define LIGHTRAY_PP_SEQ_SIZE_139_LIGHTRAY_PP_SEQ_SIZE_GET 139
-#define LIGHTRAY_PP_SEQ_SIZE_140_LIGHTRAY_PP_SEQ_SIZE_GET 140
-#define LIGHTRAY_PP_SEQ_SIZE_141_LIGHTRAY_PP_SEQ_SIZE_GET 141
-#define LIGHTRAY_PP_SEQ_SIZE_142_LIGHTRAY_PP_SEQ_SIZE_GET 142
-#define LIGHTRAY_PP_SEQ_SIZE_143_LIGHTRAY_PP_SEQ_SIZE_GET 143
-#define LIGHTRAY_PP_SEQ_SIZE_144_LIGHTRAY_PP_SEQ_SIZE_GET 144
-#define LIGHTRAY_PP_SEQ_SIZE_145_LIGHTRAY_PP_SEQ_SIZE_GET 145
-#define LIGHTRAY_PP_SEQ_SIZE_146_LIGHTRAY_PP_SEQ_SIZE_GET 146
-#define LIGHTRAY_PP_SEQ_SIZE_147_LIGHTRAY_PP_SEQ_SIZE_GET 147
-#define LIGHTRAY_PP_SEQ_SIZE_148_LIGHTRAY_PP_SEQ_SIZE_GET 148
-#define LIGHTRAY_PP_SEQ_SIZE_149_LIGHTRAY_PP_SEQ_SIZE_GET 149
-#define LIGHTRAY_PP_SEQ_SIZE_150_LIGHTRAY_PP_SEQ_SIZE_GET 150
-#define LIGHTRAY_PP_SEQ_SIZE_151_LIGHTRAY_PP_SEQ_SIZE_GET 151
-#define LIGHTRAY_PP_SEQ_SIZE_152_LIGHTRAY_PP_SEQ_SIZE_GET 152
-#define LIGHTRAY_PP_SEQ_SIZE_153_LIGHTRAY_PP_SEQ_SIZE_GET 153
-#define LIGHTRAY_PP_SEQ_SIZE_154_LIGHTRAY_PP_SEQ_SIZE_GET 154
-#define LIGHTRAY_PP_SEQ_SIZE_155_LIGHTRAY_PP_SEQ_SIZE_GET 155
-#define LIGHTRAY_PP_SEQ_SIZE_156_LIGHTRAY_PP_SEQ_SIZE_GET 156
-#define LIGHTRAY_PP_SEQ_SIZE_157_LIGHTRAY_PP_SEQ_SIZE_GET 157
-#define LIGHTRAY_PP_SEQ_SIZE_158_LIGHTRAY_PP_SEQ_SIZE_GET 158
-#define LIGHTRAY_PP_SEQ_SIZE_159_LIGHTRAY_PP_SEQ_SIZE_GET 159
-#define LIGHTRAY_PP_SEQ_SIZE_160_LIGHTRAY_PP_SEQ_SIZE_GET 160
-#define LIGHTRAY_PP_SEQ_SIZE_161_LIGHTRAY_PP_SEQ_SIZE_GET 161
-#define LIGHTRAY_PP_SEQ_SIZE_162_LIGHTRAY_PP_SEQ_SIZE_GET 162
-#define LIGHTRAY_PP_SEQ_SIZE_163_LIGHTRAY_PP_SEQ_SIZE_GET 163
-#define LIGHTRAY_PP_SEQ_SIZE_164_LIGHTRAY_PP_SEQ_SIZE_GET 164
-#define LIGHTRAY_PP_SEQ_SIZE_165_LIGHTRAY_PP_SEQ_SIZE_GET 165
-#define LIGHTRAY_PP_SEQ_SIZE_166_LIGHTRAY_PP_SEQ_SIZE_GET 166
-#define LIGHTRAY_PP_SEQ_SIZE_167_LIGHTRAY_PP_SEQ_SIZE_GET 167
-#define LIGHTRAY_PP_SEQ_SIZE_168_LIGHTRAY_PP_SEQ_SIZE_GET 168
-#define LIGHTRAY_PP_SEQ_SIZE_169_LIGHTRAY_PP_SEQ_SIZE_GET 169
-#define LIGHTRAY_PP_SEQ_SIZE_170_LIGHTRAY_PP_SEQ_SIZE_GET 170
-#define LIGHTRAY_PP_SEQ_SIZE_171_LIGHTRAY_PP_SEQ_SIZE_GET 171
-#define LIGHTRAY_PP_SEQ_SIZE_172_LIGHTRAY_PP_SEQ_SIZE_GET 172
-#define LIGHTRAY_PP_SEQ_SIZE_173_LIGHTRAY_PP_SEQ_SIZE_GET 173
-#define LIGHTRAY_PP_SEQ_SIZE_174_LIGHTRAY_PP_SEQ_SIZE_GET 174
-#define LIGHTRAY_PP_SEQ_SIZE_175_LIGHTRAY_PP_SEQ_SIZE_GET 175
-#define LIGHTRAY_PP_SEQ_SIZE_176_LIGHTRAY_PP_SEQ_SIZE_GET 176
-#define LIGHTRAY_PP_SEQ_SIZE_177_LIGHTRAY_PP_SEQ_SIZE_GET 177
-#define LIGHTRAY_PP_SEQ_SIZE_178_LIGHTRAY_PP_SEQ_SIZE_GET 178
-#define LIGHTRAY_PP_SEQ_SIZE_179_LIGHTRAY_PP_SEQ_SIZE_GET 179
-#define LIGHTRAY_PP_SEQ_SIZE_180_LIGHTRAY_PP_SEQ_SIZE_GET 180
-#define LIGHTRAY_PP_SEQ_SIZE_181_LIGHTRAY_PP_SEQ_SIZE_GET 181
-#define LIGHTRAY_PP_SEQ_SIZE_182_LIGHTRAY_PP_SEQ_SIZE_GET 182
-#define LIGHTRAY_PP_SEQ_SIZE_183_LIGHTRAY_PP_SEQ_SIZE_GET 183
-#define LIGHTRAY_PP_SEQ_SIZE_184_LIGHTRAY_PP_SEQ_SIZE_GET 184
-#define LIGHTRAY_PP_SEQ_SIZE_185_LIGHTRAY_PP_SEQ_SIZE_GET 185
-#define LIGHTRAY_PP_SEQ_SIZE_186_LIGHTRAY_PP_SEQ_SIZE_GET 186
-#define LIGHTRAY_PP_SEQ_SIZE_187_LIGHTRAY_PP_SEQ_SIZE_GET 187
-#define LIGHTRAY_PP_SEQ_SIZE_188_LIGHTRAY_PP_SEQ_SIZE_GET 188
-#define LIGHTRAY_PP_SEQ_SIZE_189_LIGHTRAY_PP_SEQ_SIZE_GET 189
-#define LIGHTRAY_PP_SEQ_SIZE_190_LIGHTRAY_PP_SEQ_SIZE_GET 190
-#define LIGHTRAY_PP_SEQ_SIZE_191_LIGHTRAY_PP_SEQ_SIZE_GET 191
-#define LIGHTRAY_PP_SEQ_SIZE_192_LIGHTRAY_PP_SEQ_SIZE_GET 192
-#define LIGHTRAY_PP_SEQ_SIZE_193_LIGHTRAY_PP_SEQ_SIZE_GET 193
-#define LIGHTRAY_PP_SEQ_SIZE_194_LIGHTRAY_PP_SEQ_SIZE_GET 194
-#define LIGHTRAY_PP_SEQ_SIZE_195_LIGHTRAY_PP_SEQ_SIZE_GET 195
-#define LIGHTRAY_PP_SEQ_SIZE_196_LIGHTRAY_PP_SEQ_SIZE_GET 196
-#define LIGHTRAY_PP_SEQ_SIZE_197_LIGHTRAY_PP_SEQ_SIZE_GET 197
-#define LIGHTRAY_PP_SEQ_SIZE_198_LIGHTRAY_PP_SEQ_SIZE_GET 198
-#define LIGHTRAY_PP_SEQ_SIZE_199_LIGHTRAY_PP_SEQ_SIZE_GET 199
-#define LIGHTRAY_PP_SEQ_SIZE_200_LIGHTRAY_PP_SEQ_SIZE_GET 200
-#define LIGHTRAY_PP_SEQ_SIZE_201_LIGHTRAY_PP_SEQ_SIZE_GET 201
-#define LIGHTRAY_PP_SEQ_SIZE_202_LIGHTRAY_PP_SEQ_SIZE_GET 202
-#define LIGHTRAY_PP_SEQ_SIZE_203_LIGHTRAY_PP_SEQ_SIZE_GET 203
-#define LIGHTRAY_PP_SEQ_SIZE_204_LIGHTRAY_PP_SEQ_SIZE_GET 204
-#define LIGHTRAY_PP_SEQ_SIZE_205_LIGHTRAY_PP_SEQ_SIZE_GET 205
-#define LIGHTRAY_PP_SEQ_SIZE_206_LIGHTRAY_PP_SEQ_SIZE_GET 206
-#define LIGHTRAY_PP_SEQ_SIZE_207_LIGHTRAY_PP_SEQ_SIZE_GET 207
-#define LIGHTRAY_PP_SEQ_SIZE_208_LIGHTRAY_PP_SEQ_SIZE_GET 208
-#define LIGHTRAY_PP_SEQ_SIZE_209_LIGHTRAY_PP_SEQ_SIZE_GET 209
-#define LIGHTRAY_PP_SEQ_SIZE_210_LIGHTRAY_PP_SEQ_SIZE_GET 210
-#define LIGHTRAY_PP_SEQ_SIZE_211_LIGHTRAY_PP_SEQ_SIZE_GET 211
-#define LIGHTRAY_PP_SEQ_SIZE_212_LIGHTRAY_PP_SEQ_SIZE_GET 212
-#define LIGHTRAY_PP_SEQ_SIZE_213_LIGHTRAY_PP_SEQ_SIZE_GET 213
-#define LIGHTRAY_PP_SEQ_SIZE_214_LIGHTRAY_PP_SEQ_SIZE_GET 214
-#define LIGHTRAY_PP_SEQ_SIZE_215_LIGHTRAY_PP_SEQ_SIZE_GET 215
-#define LIGHTRAY_PP_SEQ_SIZE_216_LIGHTRAY_PP_SEQ_SIZE_GET 216
-#define LIGHTRAY_PP_SEQ_SIZE_217_LIGHTRAY_PP_SEQ_SIZE_GET 217
-#define LIGHTRAY_PP_SEQ_SIZE_218_LIGHTRAY_PP_SEQ_SIZE_GET 218
-#define LIGHTRAY_PP_SEQ_SIZE_219_LIGHTRAY_PP_SEQ_SIZE_GET 219
-#define LIGHTRAY_PP_SEQ_SIZE_220_LIGHTRAY_PP_SEQ_SIZE_GET 220
-#define LIGHTRAY_PP_SEQ_SIZE_221_LIGHTRAY_PP_SEQ_SIZE_GET 221
-#define LIGHTRAY_PP_SEQ_SIZE_222_LIGHTRAY_PP_SEQ_SIZE_GET 222
-#define LIGHTRAY_PP_SEQ_SIZE_223_LIGHTRAY_PP_SEQ_SIZE_GET 223
-#define LIGHTRAY_PP_SEQ_SIZE_224_LIGHTRAY_PP_SEQ_SIZE_GET 224
-#define LIGHTRAY_PP_SEQ_SIZE_225_LIGHTRAY_PP_SEQ_SIZE_GET 225
-#define LIGHTRAY_PP_SEQ_SIZE_226_LIGHTRAY_PP_SEQ_SIZE_GET 226
-#define LIGHTRAY_PP_SEQ_SIZE_227_LIGHTRAY_PP_SEQ_SIZE_GET 227
-#define LIGHTRAY_PP_SEQ_SIZE_228_LIGHTRAY_PP_SEQ_SIZE_GET 228
-#define LIGHTRAY_PP_SEQ_SIZE_229_LIGHTRAY_PP_SEQ_SIZE_GET 229
-#define LIGHTRAY_PP_SEQ_SIZE_230_LIGHTRAY_PP_SEQ_SIZE_GET 230
-#define LIGHTRAY_PP_SEQ_SIZE_231_LIGHTRAY_PP_SEQ_SIZE_GET 231
-#define LIGHTRAY_PP_SEQ_SIZE_232_LIGHTRAY_PP_SEQ_SIZE_GET 232
-#define LIGHTRAY_PP_SEQ_SIZE_233_LIGHTRAY_PP_SEQ_SIZE_GET 233
-#define LIGHTRAY_PP_SEQ_SIZE_234_LIGHTRAY_PP_SEQ_SIZE_GET 234
-#define LIGHTRAY_PP_SEQ_SIZE_235_LIGHTRAY_PP_SEQ_SIZE_GET 235
-#define LIGHTRAY_PP_SEQ_SIZE_236_LIGHTRAY_PP_SEQ_SIZE_GET 236
-#define LIGHTRAY_PP_SEQ_SIZE_237_LIGHTRAY_PP_SEQ_SIZE_GET 237
-#define LIGHTRAY_PP_SEQ_SIZE_238_LIGHTRAY_PP_SEQ_SIZE_GET 238
-#define LIGHTRAY_PP_SEQ_SIZE_239_LIGHTRAY_PP_SEQ_SIZE_GET 239
-#define LIGHTRAY_PP_SEQ_SIZE_240_LIGHTRAY_PP_SEQ_SIZE_GET 240
-#define LIGHTRAY_PP_SEQ_SIZE_241_LIGHTRAY_PP_SEQ_SIZE_GET 241
-#define LIGHTRAY_PP_SEQ_SIZE_242_LIGHTRAY_PP_SEQ_SIZE_GET 242
-#define LIGHTRAY_PP_SEQ_SIZE_243_LIGHTRAY_PP_SEQ_SIZE_GET 243
-#define LIGHTRAY_PP_SEQ_SIZE_244_LIGHTRAY_PP_SEQ_SIZE_GET 244
-#define LIGHTRAY_PP_SEQ_SIZE_245_LIGHTRAY_PP_SEQ_SIZE_GET 245
-#define LIGHTRAY_PP_SEQ_SIZE_246_LIGHTRAY_PP_SEQ_SIZE_GET 246
-#define LIGHTRAY_PP_SEQ_SIZE_247_LIGHTRAY_PP_SEQ_SIZE_GET 247
-#define LIGHTRAY_PP_SEQ_SIZE_248_LIGHTRAY_PP_SEQ_SIZE_GET 248
-#define LIGHTRAY_PP_SEQ_SIZE_249_LIGHTRAY_PP_SEQ_SIZE_GET 249
-#define LIGHTRAY_PP_SEQ_SIZE_250_LIGHTRAY_PP_SEQ_SIZE_GET 250
-#define LIGHTRAY_PP_SEQ_SIZE_251_LIGHTRAY_PP_SEQ_SIZE_GET 251
-#define LIGHTRAY_PP_SEQ_SIZE_252_LIGHTRAY_PP_SEQ_SIZE_GET 252
-#define LIGHTRAY_PP_SEQ_SIZE_253_LIGHTRAY_PP_SEQ_SIZE_GET 253
-#define LIGHTRAY_PP_SEQ_SIZE_254_LIGHTRAY_PP_SEQ_SIZE_GET 254
-#define LIGHTRAY_PP_SEQ_SIZE_255_LIGHTRAY_PP_SEQ_SIZE_GET 255
 
 
 #endif
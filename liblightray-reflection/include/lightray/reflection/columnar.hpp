@@ -0,0 +1,504 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lightray/metaprogramming/fixed_string.hpp>
+#include <lightray/metaprogramming/value.hpp>
+
+#include "layout.hpp"
+#include "meta_cache.hpp"
+#include "meta_extraction.hpp"
+#include "schema.hpp"
+#include "type_info.hpp"
+
+
+/*
+ * A columnar file format for collections of reflected records.
+ *
+ * Each data member of the record type is stored as a separate column, so that a reader
+ * only touches the pages of the columns it uses. The file is laid out as:
+ *
+ *  header:     magic (8 bytes), row count (u64), schema_hash<T>() (u64), column count (u64)
+ *  columns:    for each column, name length (u64), element size (u64), element alignment (u64),
+ *              data offset (u64), followed by the name
+ *  data:       for each column, row count elements in native representation, starting at
+ *              its data offset, which is aligned to column_alignment.
+ *
+ * Only records whose data members are all trivially copyable can be stored.
+ */
+namespace lightray::refl::columnar
+{
+    /*
+     * Thrown when opening a file which is not a columnar file of the expected record type.
+     */
+    struct format_error : std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+
+    }; // struct format_error
+
+    // Column data is aligned to pages, so that reading a column never maps a page of another.
+    inline constexpr std::size_t column_alignment = 4096;
+
+    inline constexpr std::array<char, 8> file_magic = {'L', 'R', 'C', 'O', 'L', 'v', '0', '1'};
+
+    namespace detail
+    {
+        template <auto Member>
+        using column_type_t = refl::detail::layout_member_type_t<Member>;
+
+        template <typename T>
+        concept column_record =
+            reflected<T>
+         && type_info_<T>.data_members().apply([]<auto... Members>{
+                return (... && (
+                    std::is_trivially_copyable_v<column_type_t<Members>>
+                 && !std::is_pointer_v<column_type_t<Members>>
+                ));
+            });
+
+        template <auto Member>
+        constexpr auto column_name = Member.name();
+
+        template <auto Member>
+        constexpr auto column_name_view() noexcept -> std::string_view
+        {
+            return std::string_view{column_name<Member>.c_str()};
+        }
+
+        constexpr auto align_up(std::uint64_t offset) noexcept -> std::uint64_t
+        {
+            return (offset + column_alignment - 1) / column_alignment * column_alignment;
+        }
+
+        struct column_header
+        {
+            std::uint64_t name_size;
+            std::uint64_t element_size;
+            std::uint64_t element_alignment;
+            std::uint64_t data_offset;
+
+        }; // struct column_header
+
+        struct file_header
+        {
+            std::array<char, 8> magic;
+            std::uint64_t row_count;
+            std::uint64_t schema_hash;
+            std::uint64_t column_count;
+
+        }; // struct file_header
+
+        template <reflected T>
+        auto columns_headers_size() noexcept -> std::uint64_t
+        {
+            std::uint64_t size = sizeof(file_header);
+            type_info_<T>.data_members().for_each([&]<auto Member>{
+                size += sizeof(column_header) + column_name_view<Member>().size();
+            });
+            return size;
+        }
+
+        // Writes all of data to fd at offset. Throws std::system_error on failure.
+        inline auto write_all(int fd, const void* data, std::size_t size, std::uint64_t offset) -> void
+        {
+            const auto* bytes = static_cast<const std::byte*>(data);
+            while (size != 0)
+            {
+                const auto written = ::pwrite(fd, bytes, size, static_cast<off_t>(offset));
+                if (written < 0 && errno == EINTR)
+                    continue;
+                if (written < 0)
+                    throw std::system_error(errno, std::generic_category(), "pwrite");
+
+                bytes += written;
+                size -= static_cast<std::size_t>(written);
+                offset += static_cast<std::uint64_t>(written);
+            }
+        }
+
+        inline constexpr std::size_t spill_buffer_size = std::size_t{1} << 16;
+
+        /*
+         * The elements of one column, in an unnamed file which is removed as soon as it is created,
+         * and in a buffer of the last elements appended which are not yet written to it.
+         */
+        class column_spill
+        {
+        private:
+            int _fd = -1;
+            std::uint64_t _file_size = 0;
+            std::vector<std::byte> _buffer;
+
+        public:
+            explicit column_spill(const std::filesystem::path& path)
+            {
+                _fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+                if (_fd < 0)
+                    throw std::system_error(errno, std::generic_category(), "refl::columnar::writer: cannot create " + path.string());
+                ::unlink(path.c_str());
+                _buffer.reserve(spill_buffer_size);
+            }
+
+            column_spill(column_spill&& other) noexcept
+            :   _fd(std::exchange(other._fd, -1)),
+                _file_size(std::exchange(other._file_size, 0)),
+                _buffer(std::move(other._buffer))
+            {}
+
+            column_spill(const column_spill&) = delete;
+            auto operator=(const column_spill&) -> column_spill& = delete;
+
+            ~column_spill()
+            {
+                if (_fd >= 0)
+                    ::close(_fd);
+            }
+
+            // Bytes appended so far.
+            auto size() const noexcept -> std::uint64_t
+            {
+                return _file_size + _buffer.size();
+            }
+
+            auto append(const void* data, std::size_t size) -> void
+            {
+                if (_buffer.size() + size > spill_buffer_size)
+                    flush();
+
+                const auto* bytes = static_cast<const std::byte*>(data);
+                _buffer.insert(_buffer.end(), bytes, bytes + size);
+            }
+
+            auto flush() -> void
+            {
+                write_all(_fd, _buffer.data(), _buffer.size(), _file_size);
+                _file_size += _buffer.size();
+                _buffer.clear();
+            }
+
+            // Copies every byte appended to out at offset, through scratch.
+            auto copy_to(int out, std::uint64_t offset, std::span<std::byte> scratch) -> void
+            {
+                flush();
+                for (std::uint64_t copied = 0; copied < _file_size;)
+                {
+                    const auto chunk = static_cast<std::size_t>(std::min<std::uint64_t>(scratch.size(), _file_size - copied));
+                    const auto read = ::pread(_fd, scratch.data(), chunk, static_cast<off_t>(copied));
+                    if (read < 0 && errno == EINTR)
+                        continue;
+                    if (read <= 0)
+                        throw std::system_error(read < 0 ? errno : EIO, std::generic_category(), "pread");
+
+                    write_all(out, scratch.data(), static_cast<std::size_t>(read), offset + copied);
+                    copied += static_cast<std::uint64_t>(read);
+                }
+            }
+
+        }; // class column_spill
+
+    } // namespace detail
+
+    /*
+     * Collects records of type T and writes them to a columnar file.
+     *
+     * Each column is spilled, through a buffer of spill_buffer_size bytes, into an unnamed file
+     * next to the output file as records arrive, so that the memory used does not grow with the
+     * row count. close() writes the header and copies the spilled columns into place, and the
+     * destructor calls it if it was not called explicitly.
+     */
+    template <detail::column_record T>
+    class writer
+    {
+    private:
+        static constexpr auto column_count = type_info_<T>.data_members().size();
+
+        std::filesystem::path _path;
+        std::uint64_t _row_count = 0;
+        std::vector<detail::column_spill> _columns;
+        bool _closed = false;
+
+    public:
+        /*
+         * Throws std::system_error if the spill files cannot be created next to path.
+         */
+        explicit writer(std::filesystem::path path) : _path(std::move(path))
+        {
+            _columns.reserve(column_count);
+            for (std::size_t i = 0; i < column_count; ++i)
+                _columns.emplace_back(std::filesystem::path(_path).concat(".column" + std::to_string(i)));
+        }
+
+        writer(const writer&) = delete;
+        auto operator=(const writer&) -> writer& = delete;
+
+        ~writer()
+        {
+            if (!_closed)
+                try { close(); } catch (...) {}
+        }
+
+        auto size() const noexcept -> std::uint64_t
+        {
+            return _row_count;
+        }
+
+        auto push_back(const T& record) -> void
+        {
+            mtp::make_index_sequence<column_count>.for_each([&]<std::size_t I>{
+                constexpr auto member = type_info_<T>.data_members().template get<I>();
+                _columns[I].append(std::addressof(member.invoke(record)), sizeof(detail::column_type_t<member>));
+            });
+            ++_row_count;
+        }
+
+        auto write(std::span<const T> records) -> void
+        {
+            for (const auto& record : records)
+                push_back(record);
+        }
+
+        /*
+         * Writes the file. Throws std::system_error if it cannot be written, in which case
+         * the records are kept and close() may be called again.
+         */
+        auto close() -> void
+        {
+            if (_closed)
+                return;
+
+            const auto fail = [&](int error, const char* what) {
+                throw std::system_error(error, std::generic_category(), "refl::columnar::writer: cannot " + (what + (" " + _path.string())));
+            };
+
+            const int fd = ::open(_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd < 0)
+                fail(errno, "open");
+
+            try
+            {
+                std::uint64_t position = 0;
+                const auto put = [&](const void* data, std::size_t size) {
+                    detail::write_all(fd, data, size, position);
+                    position += size;
+                };
+
+                const detail::file_header header{
+                    file_magic, _row_count, schema_hash<T>(), column_count
+                };
+                put(&header, sizeof(header));
+
+                auto data_offset = detail::align_up(detail::columns_headers_size<T>());
+                auto data_end = data_offset;
+                std::array<std::uint64_t, column_count> data_offsets{};
+                mtp::make_index_sequence<column_count>.for_each([&]<std::size_t I>{
+                    constexpr auto member = type_info_<T>.data_members().template get<I>();
+                    const auto name = detail::column_name_view<member>();
+                    const detail::column_header column{
+                        name.size(), sizeof(detail::column_type_t<member>), alignof(detail::column_type_t<member>), data_offset
+                    };
+                    put(&column, sizeof(column));
+                    put(name.data(), name.size());
+                    data_offsets[I] = data_offset;
+                    data_end = data_offset + _columns[I].size();
+                    data_offset = detail::align_up(data_end);
+                });
+
+                // The gaps between columns are left as holes, which read as zeros. The file is
+                // extended to the end of the last column, even if the last columns are empty.
+                std::vector<std::byte> scratch(detail::spill_buffer_size);
+                for (std::size_t i = 0; i < column_count; ++i)
+                    _columns[i].copy_to(fd, data_offsets[i], scratch);
+
+                if (::ftruncate(fd, static_cast<off_t>(data_end)) != 0)
+                    fail(errno, "write");
+            }
+            catch (const std::system_error& e)
+            {
+                ::close(fd);
+                fail(e.code().value(), "write");
+            }
+
+            if (::close(fd) != 0)
+                fail(errno, "write");
+
+            _closed = true;
+            _columns.clear();
+        }
+
+    }; // class writer
+
+    /*
+     * Memory maps a columnar file of records of type T and exposes its columns without copying.
+     *
+     * Throws std::system_error if the file cannot be mapped, and format_error if it is not
+     * a columnar file of T (i.e. its magic, schema hash or column table do not match).
+     */
+    template <detail::column_record T>
+    class reader
+    {
+    private:
+        static constexpr auto column_count = type_info_<T>.data_members().size();
+
+        const std::byte* _data = nullptr;
+        std::size_t _size = 0;
+        std::uint64_t _row_count = 0;
+        std::array<std::uint64_t, column_count> _offsets{};
+
+        auto validate() -> void
+        {
+            const auto fail = [](const char* what) { throw format_error(std::string("refl::columnar::reader: ") + what); };
+
+            detail::file_header header;
+            if (_size < sizeof(header))
+                fail("file too small");
+            std::memcpy(&header, _data, sizeof(header));
+
+            if (header.magic != file_magic)
+                fail("not a columnar file");
+            if (header.schema_hash != schema_hash<T>() || header.column_count != column_count)
+                fail("schema mismatch");
+
+            _row_count = header.row_count;
+
+            std::size_t position = sizeof(header);
+            mtp::make_index_sequence<column_count>.for_each([&]<std::size_t I>{
+                constexpr auto member = type_info_<T>.data_members().template get<I>();
+                const auto name = detail::column_name_view<member>();
+
+                detail::column_header column;
+                if (_size < position + sizeof(column) + name.size())
+                    fail("truncated column table");
+                std::memcpy(&column, _data + position, sizeof(column));
+                position += sizeof(column);
+
+                if (
+                    column.name_size != name.size()
+                 || std::string_view(reinterpret_cast<const char*>(_data + position), name.size()) != name
+                 || column.element_size != sizeof(detail::column_type_t<member>)
+                 || column.element_alignment != alignof(detail::column_type_t<member>)
+                )
+                    fail("schema mismatch");
+                position += name.size();
+
+                if (
+                    column.data_offset % column_alignment != 0
+                 || column.data_offset > _size
+                 || (_size - column.data_offset) / column.element_size < _row_count
+                )
+                    fail("truncated column data");
+
+                _offsets[I] = column.data_offset;
+            });
+        }
+
+        auto unmap() noexcept -> void
+        {
+            if (_data)
+                ::munmap(const_cast<std::byte*>(_data), _size);
+            _data = nullptr;
+        }
+
+    public:
+        explicit reader(const std::filesystem::path& path)
+        {
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                throw std::system_error(errno, std::generic_category(), "refl::columnar::reader: cannot open " + path.string());
+
+            struct stat st;
+            if (::fstat(fd, &st) != 0)
+            {
+                const auto error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "refl::columnar::reader: cannot stat " + path.string());
+            }
+
+            _size = static_cast<std::size_t>(st.st_size);
+            void* mapped = _size ? ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0) : nullptr;
+            const auto error = errno;
+            ::close(fd);
+
+            if (mapped == MAP_FAILED)
+                throw std::system_error(error, std::generic_category(), "refl::columnar::reader: cannot map " + path.string());
+            _data = static_cast<const std::byte*>(mapped);
+
+            try
+            {
+                validate();
+            }
+            catch (...)
+            {
+                unmap();
+                throw;
+            }
+        }
+
+        reader(reader&& other) noexcept
+        :   _data(std::exchange(other._data, nullptr)),
+            _size(std::exchange(other._size, 0)),
+            _row_count(std::exchange(other._row_count, 0)),
+            _offsets(other._offsets)
+        {}
+
+        auto operator=(reader&& other) noexcept -> reader&
+        {
+            if (this != &other)
+            {
+                unmap();
+                _data = std::exchange(other._data, nullptr);
+                _size = std::exchange(other._size, 0);
+                _row_count = std::exchange(other._row_count, 0);
+                _offsets = other._offsets;
+            }
+            return *this;
+        }
+
+        ~reader()
+        {
+            unmap();
+        }
+
+        auto size() const noexcept -> std::uint64_t
+        {
+            return _row_count;
+        }
+
+        /*
+         * Returns the column of the data member named Name, e.g. r.column<"price">().
+         * The span is valid for as long as this reader.
+         */
+        template <mtp::fixed_string Name>
+        auto column() const noexcept -> auto
+        {
+            constexpr auto index = meta_cache<T>::data_index_of(Name.c_str());
+            static_assert(index < column_count, "T has no data member with this name");
+
+            using element_type = detail::column_type_t<type_info_<T>.data_members().template get<index>()>;
+            return std::span<const element_type>{
+                reinterpret_cast<const element_type*>(_data + _offsets[index]), static_cast<std::size_t>(_row_count)
+            };
+        }
+
+    }; // class reader
+
+} // namespace lightray::refl::columnar
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include <lightray/metaprogramming/value_pack.hpp>
+
+#include "layout.hpp"
+#include "meta_extraction.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    template <reflected T>
+    constexpr auto equal(const T& a, const T& b) -> bool;
+
+    template <reflected T>
+    constexpr auto compare(const T& a, const T& b) -> auto;
+
+    namespace detail
+    {
+        /*
+         * A run of data members [first, last) of the same type, in declaration order.
+         * If bytewise is true, the members are adjacent bytewise members occupying
+         * [offset, offset + size) of the object, and the run is compared with a single memcmp.
+         */
+        struct compare_run
+        {
+            std::size_t first;
+            std::size_t last;
+            std::ptrdiff_t offset;
+            std::size_t size;
+            bool bytewise;
+        };
+
+        template <std::size_t N>
+        struct compare_run_list
+        {
+            std::array<compare_run, N> runs;
+            std::size_t count;
+        };
+
+        template <reflected T>
+        constexpr auto compare_make_runs() noexcept -> auto
+        {
+            constexpr auto member_count = type_info_<T>.data_members().size();
+            constexpr auto bytewise = type_info_<T>.data_members().apply([]<auto... Members>{
+                return std::array<bool, sizeof...(Members)>{is_bytewise_v<layout_member_type_t<Members>>...};
+            });
+            constexpr auto sizes = layout_member_sizes<T>();
+
+            compare_run_list<member_count> result{};
+            if constexpr (!layout_has_constexpr_offsets<T>())
+            {
+                for (std::size_t i = 0; i < member_count; ++i)
+                    result.runs[result.count++] = {i, i + 1, 0, sizes[i], false};
+            }
+            else
+            {
+                constexpr auto offsets = layout_member_offsets<T>();
+                for (std::size_t i = 0; i < member_count; ++i)
+                {
+                    auto* prev = result.count ? &result.runs[result.count - 1] : nullptr;
+                    if (
+                        prev && prev->bytewise && bytewise[i]
+                     && prev->offset + static_cast<std::ptrdiff_t>(prev->size) == offsets[i]
+                    )
+                    {
+                        prev->last = i + 1;
+                        prev->size += sizes[i];
+                    }
+                    else
+                        result.runs[result.count++] = {i, i + 1, offsets[i], sizes[i], bytewise[i]};
+                }
+            }
+            return result;
+        }
+
+        template <reflected T>
+        constexpr auto compare_runs = compare_make_runs<T>();
+
+        // Built-in arrays, whose operators would compare addresses, and ranges whose elements
+        // (transitively) are reflected types, e.g. std::vector<T>, whose own operators would
+        // require T to define operator== and operator<=>.
+        template <typename T>
+        constexpr bool compare_elementwise_range = []
+        {
+            if constexpr (std::is_array_v<T>)
+                return true;
+
+            else if constexpr (std::ranges::input_range<const T>)
+                return reflected<std::ranges::range_value_t<const T>>
+                    || compare_elementwise_range<std::ranges::range_value_t<const T>>;
+            else
+                return false;
+        } ();
+
+        template <typename T>
+        constexpr auto compare_value_equal(const T& a, const T& b) -> bool
+        {
+            if constexpr (reflected<T>)
+                return refl::equal(a, b);
+
+            else if constexpr (compare_elementwise_range<T>)
+                return std::ranges::equal(a, b, [](const auto& x, const auto& y) {
+                    return compare_value_equal(x, y);
+                });
+
+            else
+                return a == b;
+        }
+
+        template <typename T>
+        constexpr auto compare_value(const T& a, const T& b) -> auto
+        {
+            if constexpr (reflected<T>)
+                return refl::compare(a, b);
+
+            else if constexpr (compare_elementwise_range<T>)
+                return std::lexicographical_compare_three_way(
+                    std::ranges::begin(a), std::ranges::end(a),
+                    std::ranges::begin(b), std::ranges::end(b),
+                    [](const auto& x, const auto& y) { return compare_value(x, y); }
+                );
+
+            else
+                return a <=> b;
+        }
+
+        template <typename T>
+        using compare_value_result_t = decltype(compare_value(std::declval<const T&>(), std::declval<const T&>()));
+
+        template <reflected T, std::size_t... Is>
+        auto compare_result_type(std::index_sequence<Is...>) -> std::common_comparison_category_t<
+            compare_value_result_t<layout_member_type_t<type_info_<T>.data_members().template get<Is>()>>...
+        >;
+
+        template <reflected T>
+        using compare_result_t = decltype(
+            compare_result_type<T>(std::make_index_sequence<type_info_<T>.data_members().size()>{})
+        );
+
+        template <reflected T, std::size_t R>
+        auto compare_run_bytes_equal(const T& a, const T& b) noexcept -> bool
+        {
+            constexpr auto& Run = compare_runs<T>.runs[R];
+            return std::memcmp(
+                reinterpret_cast<const unsigned char*>(&a) + Run.offset,
+                reinterpret_cast<const unsigned char*>(&b) + Run.offset,
+                Run.size
+            ) == 0;
+        }
+
+        template <reflected T, std::size_t R>
+        constexpr auto compare_run_equal(const T& a, const T& b) -> bool
+        {
+            constexpr auto& Run = compare_runs<T>.runs[R];
+            constexpr auto members = type_info_<T>.data_members();
+
+            // a single member is better left to operator== which the optimizer understands.
+            if constexpr (Run.bytewise && Run.last - Run.first > 1)
+                if (!std::is_constant_evaluated())
+                    return compare_run_bytes_equal<T, R>(a, b);
+
+            return mtp::make_index_sequence<Run.last - Run.first>.apply([&]<std::size_t... Is>{
+                return (... && compare_value_equal(
+                    members.template get<Run.first + Is>().invoke(a),
+                    members.template get<Run.first + Is>().invoke(b)
+                ));
+            });
+        }
+
+        template <reflected T, std::size_t R>
+        constexpr auto compare_run_compare(const T& a, const T& b) -> compare_result_t<T>
+        {
+            constexpr auto& Run = compare_runs<T>.runs[R];
+            constexpr auto members = type_info_<T>.data_members();
+
+            // Byte order does not match value order in general, so memcmp can only
+            // skip the run when it is equal, which is the common case when deduplicating.
+            if constexpr (Run.bytewise && Run.last - Run.first > 1)
+                if (!std::is_constant_evaluated() && compare_run_bytes_equal<T, R>(a, b))
+                    return std::strong_ordering::equal;
+
+            compare_result_t<T> result = std::strong_ordering::equal;
+            mtp::make_index_sequence<Run.last - Run.first>.apply([&]<std::size_t... Is>{
+                (void)(... || ((result = compare_value(
+                    members.template get<Run.first + Is>().invoke(a),
+                    members.template get<Run.first + Is>().invoke(b)
+                )) != 0));
+            });
+            return result;
+        }
+
+    } // namespace detail
+
+    /*
+     * Compares each reflected non-static data member of a and b for equality, in declaration order.
+     *
+     * Members of reflected types are compared with refl::equal, built-in arrays and
+     * ranges of reflected types element by element, and others with operator==.
+     * Runs of adjacent members which are bytewise (see is_bytewise_v) and not separated
+     * by padding are compared with a single memcmp. Unreflected members are ignored.
+     */
+    template <reflected T>
+    constexpr auto equal(const T& a, const T& b) -> bool
+    {
+        return mtp::make_index_sequence<detail::compare_runs<T>.count>.apply([&]<std::size_t... Rs>{
+            return (... && detail::compare_run_equal<T, Rs>(a, b));
+        });
+    }
+
+    /*
+     * Lexicographically compares each reflected non-static data member of a and b,
+     * in declaration order, and returns the first non-equal result.
+     *
+     * Members of reflected types are compared with refl::compare, built-in arrays and
+     * ranges of reflected types element by element, and others with operator<=>.
+     * The result type is the common comparison category of every member comparison.
+     * Runs of members that refl::equal compares with a single memcmp are skipped
+     * with that memcmp when they are equal.
+     */
+    template <reflected T>
+    constexpr auto compare(const T& a, const T& b) -> auto
+    {
+        detail::compare_result_t<T> result = std::strong_ordering::equal;
+        mtp::make_index_sequence<detail::compare_runs<T>.count>.apply([&]<std::size_t... Rs>{
+            (void)(... || ((result = detail::compare_run_compare<T, Rs>(a, b)) != 0));
+        });
+        return result;
+    }
+
+} // namespace lightray::refl
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include <lightray/metaprogramming/value_pack.hpp>
+
+#include "attribute.hpp"
+#include "meta_category.hpp"
+
+
+namespace lightray::refl
+{
+    /*
+     * Attribute hinting the relative cost of processing a variable member, e.g.
+     *  (var, particles, (attributes(refl::cost_hint{100})))
+     *
+     * Members without a hint have a cost of 1. See by_cost_hint.
+     */
+    struct cost_hint : attribute<meta_category::variable>
+    {
+        std::size_t cost;
+
+        constexpr cost_hint(std::size_t cost) noexcept : cost(cost) {}
+
+    }; // struct cost_hint
+
+    namespace detail
+    {
+        template <auto Member>
+        constexpr auto cost_hint_of() noexcept -> std::size_t
+        {
+            using attributes_type = decltype(Member.attributes());
+
+            std::size_t cost = 1;
+            mtp::make_index_sequence<std::tuple_size_v<attributes_type>>.for_each([&]<std::size_t I>{
+                if constexpr (std::is_same_v<std::remove_cvref_t<std::tuple_element_t<I, attributes_type>>, cost_hint>)
+                    cost = std::get<I>(Member.attributes()).cost;
+            });
+            return cost;
+        }
+
+        // Positions of Members sorted by decreasing cost, ties kept in order.
+        template <auto... Members>
+        constexpr auto cost_hint_order = []
+        {
+            constexpr std::array<std::size_t, sizeof...(Members)> costs{cost_hint_of<Members>()...};
+
+            std::array<std::size_t, sizeof...(Members)> order{};
+            for (std::size_t i = 0; i < order.size(); ++i)
+            {
+                std::size_t j = i;
+                for (; j > 0 && costs[order[j - 1]] < costs[i]; --j)
+                    order[j] = order[j - 1];
+                order[j] = i;
+            }
+            return order;
+        } ();
+
+    } // namespace detail
+
+    /*
+     * Returns members reordered by decreasing cost_hint, so that parallel_for_each
+     * schedules the most expensive members first.
+     *
+     * For example:
+     *  by_cost_hint(type_info_<T>.data_members()).parallel_for_each(executor, fn);
+     */
+    template <auto... Members>
+    constexpr auto by_cost_hint(mtp::value_pack_t<Members...>) noexcept -> auto
+    {
+        return mtp::make_index_sequence<sizeof...(Members)>.apply([]<std::size_t... Is>{
+            return mtp::value_pack<
+                mtp::value_pack_t<Members...>::template get<detail::cost_hint_order<Members...>[Is]>()...
+            >;
+        });
+    }
+
+} // namespace lightray::refl
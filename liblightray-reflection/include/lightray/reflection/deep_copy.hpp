@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <type_traits>
+
+#include "meta_extraction.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    namespace detail
+    {
+        template <typename T>
+        concept deep_copy_trivial =
+            std::is_trivially_copyable_v<T>
+         && !std::is_pointer_v<T>
+         && !std::is_member_pointer_v<T>;
+
+        template <typename T>
+        concept deep_copy_resizable_range =
+            std::ranges::sized_range<T>
+         && std::ranges::forward_range<T>
+         && requires (T& t, std::size_t n) { t.resize(n); };
+
+        // Containers which allocate through a std::pmr::polymorphic_allocator, e.g. std::pmr::vector.
+        template <typename T>
+        concept deep_copy_arena_container =
+            std::uses_allocator_v<T, std::pmr::polymorphic_allocator<std::byte>>
+         && requires (const T& t) { { t.get_allocator().resource() } -> std::same_as<std::pmr::memory_resource*>; };
+
+        template <typename T>
+        auto deep_copy_value(const T& src, T& dst, std::pmr::memory_resource* arena) -> void
+        {
+            if constexpr (deep_copy_trivial<T>)
+            {
+                std::memcpy(std::addressof(dst), std::addressof(src), sizeof(T));
+            }
+            else if constexpr (reflected<T>)
+            {
+                type_info_<T>.data_members().for_each([&]<auto Member>{
+                    deep_copy_value(Member.invoke(src), Member.invoke(dst), arena);
+                });
+            }
+            else if constexpr (std::is_array_v<T>)
+            {
+                for (std::size_t i = 0; i < std::extent_v<T>; ++i)
+                    deep_copy_value(src[i], dst[i], arena);
+            }
+            else
+            {
+                if constexpr (deep_copy_arena_container<T>)
+                    if (arena && dst.get_allocator().resource() != arena)
+                    {
+                        std::destroy_at(std::addressof(dst));
+                        std::construct_at(std::addressof(dst), std::pmr::polymorphic_allocator<std::byte>(arena));
+                    }
+
+                if constexpr (deep_copy_resizable_range<T>)
+                {
+                    using element_type = std::ranges::range_value_t<T>;
+
+                    dst.resize(std::ranges::size(src));
+                    if constexpr (deep_copy_trivial<element_type> && std::ranges::contiguous_range<T>)
+                    {
+                        if (!dst.empty())
+                            std::memcpy(std::ranges::data(dst), std::ranges::data(src), dst.size() * sizeof(element_type));
+                    }
+                    else
+                    {
+                        auto out = std::ranges::begin(dst);
+                        for (const auto& element : src)
+                            deep_copy_value(element, *out++, arena);
+                    }
+                }
+                else
+                    dst = src;
+            }
+        }
+
+        // The value reset restores, i.e. a value-initialized T with its default member initializers.
+        template <typename T>
+        inline const T reset_initial{};
+
+    } // namespace detail
+
+    /*
+     * Copies src into dst by walking the reflected data members of T.
+     *
+     * Trivially copyable sub-objects, including whole reflected types, are copied with a single
+     * memcpy, as are the elements of contiguous containers of trivially copyable elements.
+     * Resizable containers are resized in place, which reuses the storage dst already owns,
+     * and their elements are deep copied in turn, as are the elements of built-in arrays.
+     * Any other type is copy assigned.
+     *
+     * Unreflected data members of a reflected, not trivially copyable T are left unchanged in dst.
+     */
+    template <typename T>
+    auto deep_copy(const T& src, T& dst) -> void
+    {
+        detail::deep_copy_value(src, dst, nullptr);
+    }
+
+    /*
+     * Restores every reflected data member of value to its default, i.e. to its value in T{},
+     * as with deep_copy from T{}: containers are shrunk in place and keep their capacity,
+     * so that a reset object can be refilled without allocating.
+     */
+    template <typename T>
+    requires std::is_default_constructible_v<T>
+    auto reset(T& value) -> void
+    {
+        detail::deep_copy_value(detail::reset_initial<T>, value, nullptr);
+    }
+
+    /*
+     * Allocates a deep copy of src out of arena and returns it.
+     *
+     * The copy is made as with deep_copy, in a single walk over src. In addition, every nested
+     * container which allocates through a std::pmr::polymorphic_allocator (std::pmr::vector,
+     * std::pmr::string, ...) is rebound to arena, so that with a std::pmr::monotonic_buffer_resource
+     * the whole graph is bump-allocated from one buffer.
+     *
+     * The returned object is never destroyed by arena; call std::destroy_at on it if T
+     * holds resources outside of arena.
+     */
+    template <typename T>
+    requires std::is_default_constructible_v<T>
+    auto clone_into(std::pmr::memory_resource& arena, const T& src) -> T*
+    {
+        std::pmr::polymorphic_allocator<std::byte> allocator(&arena);
+        T* dst = allocator.new_object<T>();
+        detail::deep_copy_value(src, *dst, &arena);
+        return dst;
+    }
+
+} // namespace lightray::refl
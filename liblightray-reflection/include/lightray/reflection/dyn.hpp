@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <cassert>
+#include <concepts>
 #include <cstddef>
 #include <memory>
 #include <tuple>
@@ -18,6 +20,7 @@
 #include <lightray/metaprogramming/on_destructed.hpp>
 #include <lightray/metaprogramming/overload.hpp>
 #include <lightray/metaprogramming/owning.hpp>
+#include <lightray/metaprogramming/string_id.hpp>
 #include <lightray/metaprogramming/tuple_util.hpp>
 #include <lightray/metaprogramming/type.hpp>
 #include <lightray/metaprogramming/value.hpp>
@@ -25,6 +28,7 @@
 #include <lightray/metaprogramming/traits/function_traits.hpp>
 #include <lightray/metaprogramming/traits/qualifier_traits.hpp>
 
+#include "meta_cache.hpp"
 #include "type_info.hpp"
 
 
@@ -35,19 +39,23 @@ namespace lightray::refl
 
     namespace detail
     {
-        constexpr auto dyn_copy_constructor_func_id() noexcept -> auto
+        /*
+         * Vtables are keyed by the interned names of the members, rather than by the names themselves,
+         * so that the vtable type, and every symbol naming it, does not spell out each name.
+         */
+        constexpr auto dyn_copy_constructor_func_id() noexcept -> mtp::string_id
         {
-            return mtp::fixed_string("__copy_constructor__");
+            return mtp::intern(mtp::fixed_string("__copy_constructor__"));
         }
 
-        constexpr auto dyn_destructor_func_id() noexcept -> auto
+        constexpr auto dyn_destructor_func_id() noexcept -> mtp::string_id
         {
-            return mtp::fixed_string("__destructor__");
+            return mtp::intern(mtp::fixed_string("__destructor__"));
         }
 
-        constexpr auto dyn_type_info_func_id() noexcept -> auto
+        constexpr auto dyn_type_info_func_id() noexcept -> mtp::string_id
         {
-            return mtp::fixed_string("__type_info__");
+            return mtp::intern(mtp::fixed_string("__type_info__"));
         }
 
         template <typename TargetType, typename IdAccessor, typename FuncSignature>
@@ -100,35 +108,57 @@ namespace lightray::refl
             }
         }
 
-        template <typename TargetType>
+        /*
+         * A deleter which frees into something other than the global heap, and provides a static
+         * clone(object) which copies object into storage the deleter can free, e.g. object_pool<T>::deleter.
+         */
+        template <typename Deleter, typename TargetType>
+        concept dyn_cloning_deleter = requires (const TargetType& object)
+        {
+            { Deleter::clone(object) } -> std::same_as<TargetType*>;
+        };
+
+        // Copies are made where Deleter destroys them from: with new for std::default_delete, else with Deleter::clone.
+        template <typename TargetType, typename Deleter>
         constexpr auto dyn_make_copy_constructor_function_pointer() noexcept -> auto
         {
             using self_ptr_t = mtp::void_ref_ptr<mtp::traits::const_lvalue_traits>;
             if constexpr (std::is_void_v<TargetType>)
                 return mtp::function_pointer<mtp::owning<void*> (*)(self_ptr_t)>{};
+            else if constexpr (dyn_cloning_deleter<Deleter, TargetType>)
+                return mtp::function_pointer{+[](self_ptr_t self) -> mtp::owning<void*>{
+                    return Deleter::clone(self.as<TargetType>());
+                }};
             else
                 return mtp::function_pointer{+[](self_ptr_t self) -> mtp::owning<void*>{
                     return new auto(self.as<TargetType>());
                 }};
         }
 
-        template <typename TargetType>
+        template <typename TargetType, typename Deleter>
         constexpr auto dyn_make_destructor_function_pointer() noexcept -> auto
         {
             using self_ptr_t = mtp::void_ref_ptr<mtp::traits::const_lvalue_traits>;
             if constexpr (std::is_void_v<TargetType>)
                 return mtp::function_pointer<void (*)(self_ptr_t)>{};
             else
-                return mtp::function_pointer{+[](self_ptr_t self){ delete &self.as<TargetType>(); }};
+                return mtp::function_pointer{+[](self_ptr_t self){
+                    Deleter{}(const_cast<TargetType*>(&self.as<TargetType>()));
+                }};
         }
 
-        template <typename TargetType>
+        // Targets owned through different deleters have different vtables, so they are keyed apart.
+        template <typename TargetType, typename Deleter>
         constexpr auto dyn_make_type_info_function_pointer() noexcept -> auto
         {
             if constexpr (std::is_void_v<TargetType>)
                 return mtp::function_pointer<const std::type_info& (*)()>{};
-            else
+            else if constexpr (std::is_same_v<Deleter, std::default_delete<TargetType>>)
                 return mtp::function_pointer{+[]() -> const std::type_info& { return typeid(TargetType); }};
+            else
+                return mtp::function_pointer{+[]() -> const std::type_info& {
+                    return typeid(std::unique_ptr<TargetType, Deleter>);
+                }};
         }
 
         template <typename TargetType, reflected Prototype, bool Cloneable, mtp::fixed_string Name>
@@ -136,8 +166,7 @@ namespace lightray::refl
         {
             using namespace mtp::splice::type;
 
-            constexpr auto member = type_info_<Prototype>.members()
-                .find_if([]<auto M>{ return mtp::value<M.name() == Name>; });
+            constexpr auto member = meta_cache<Prototype>::template member<Name>();
 
             using intf_proxy_t = decl_t<member.template interface_proxy_type<dyn<Prototype, Cloneable>>()>;
             
@@ -158,39 +187,55 @@ namespace lightray::refl
             });
         }
 
-        template <typename TargetType, reflected Prototype, bool Cloneable>
+        // Checked once per Prototype, rather than once per vtable.
+        template <reflected Prototype>
+        constexpr bool dyn_func_ids_are_distinct = type_info_<Prototype>.members().apply([]<auto... Members>{
+            return mtp::all_distinct(std::array{
+                mtp::intern(Members.name())...,
+                dyn_copy_constructor_func_id(),
+                dyn_destructor_func_id(),
+                dyn_type_info_func_id()
+            });
+        });
+
+        template <typename TargetType, reflected Prototype, bool Cloneable, typename Deleter = std::default_delete<TargetType>>
         constexpr auto dyn_make_vtable() noexcept -> auto
         {
             using namespace mtp::fixed_string_literals;
 
             constexpr auto members = type_info_<Prototype>.members();
 
+            static_assert(
+                dyn_func_ids_are_distinct<Prototype>,
+                "The interned names of the members of Prototype collide, please rename one of them"
+            );
+
             if constexpr (Cloneable)
                 return members.apply([]<auto... Members>{
-                    return mtp::dict_tuple(
+                    return mtp::indexed_dict_tuple(
                         mtp::value_pack<
-                            Members.name()...,
+                            mtp::intern(Members.name())...,
                             dyn_copy_constructor_func_id(),
                             dyn_destructor_func_id(),
                             dyn_type_info_func_id()
                         >,
                         dyn_make_overload<TargetType, Prototype, Cloneable, Members.name()>()...,
-                        dyn_make_copy_constructor_function_pointer<TargetType>(),
-                        dyn_make_destructor_function_pointer<TargetType>(),
-                        dyn_make_type_info_function_pointer<TargetType>()
+                        dyn_make_copy_constructor_function_pointer<TargetType, Deleter>(),
+                        dyn_make_destructor_function_pointer<TargetType, Deleter>(),
+                        dyn_make_type_info_function_pointer<TargetType, Deleter>()
                     );
                 });
             else
                 return members.apply([]<auto... Members>{
-                    return mtp::dict_tuple(
+                    return mtp::indexed_dict_tuple(
                         mtp::value_pack<
-                            Members.name()...,
+                            mtp::intern(Members.name())...,
                             dyn_destructor_func_id(),
                             dyn_type_info_func_id()
                         >,
                         dyn_make_overload<TargetType, Prototype, Cloneable, Members.name()>()...,
-                        dyn_make_destructor_function_pointer<TargetType>(),
-                        dyn_make_type_info_function_pointer<TargetType>()
+                        dyn_make_destructor_function_pointer<TargetType, Deleter>(),
+                        dyn_make_type_info_function_pointer<TargetType, Deleter>()
                     );
                 });
         }
@@ -198,8 +243,37 @@ namespace lightray::refl
         template <reflected Prototype, bool Cloneable>
         using dyn_vtable_t = decltype(dyn_make_vtable<void, Prototype, Cloneable>());
 
-        template <typename TargetType, reflected Prototype, bool Cloneable>
-        constexpr dyn_vtable_t<Prototype, Cloneable> dyn_vtable = dyn_make_vtable<TargetType, Prototype, Cloneable>();
+        template <typename TargetType, reflected Prototype, bool Cloneable, typename Deleter = std::default_delete<TargetType>>
+        constexpr dyn_vtable_t<Prototype, Cloneable> dyn_vtable = dyn_make_vtable<TargetType, Prototype, Cloneable, Deleter>();
+
+        // Whether the vtable of TargetType is instantiated in one translation unit only, see LIGHTRAY_REFL_DYN_EXTERN.
+        template <typename TargetType, reflected Prototype, bool Cloneable = false, typename Deleter = std::default_delete<TargetType>>
+        constexpr bool dyn_vtable_is_extern = false;
+
+        // Its get is neither inline nor constexpr, so that an explicit instantiation declaration
+        // of this struct keeps dyn_vtable, and every thunk in it, out of the translation unit.
+        template <typename TargetType, reflected Prototype, bool Cloneable = false, typename Deleter = std::default_delete<TargetType>>
+        struct dyn_extern_vtable
+        {
+            static auto get() noexcept -> const dyn_vtable_t<Prototype, Cloneable>*;
+
+        }; // struct dyn_extern_vtable
+
+        template <typename TargetType, reflected Prototype, bool Cloneable, typename Deleter>
+        auto dyn_extern_vtable<TargetType, Prototype, Cloneable, Deleter>::get() noexcept
+        -> const dyn_vtable_t<Prototype, Cloneable>*
+        {
+            return &dyn_vtable<TargetType, Prototype, Cloneable, Deleter>;
+        }
+
+        template <typename TargetType, reflected Prototype, bool Cloneable, typename Deleter>
+        constexpr auto dyn_vtable_pointer() noexcept -> const dyn_vtable_t<Prototype, Cloneable>*
+        {
+            if constexpr (dyn_vtable_is_extern<TargetType, Prototype, Cloneable, Deleter>)
+                return dyn_extern_vtable<TargetType, Prototype, Cloneable, Deleter>::get();
+            else
+                return &dyn_vtable<TargetType, Prototype, Cloneable, Deleter>;
+        }
 
 
         template <reflected ToPrototype, bool ToCloneable, reflected FromPrototype, bool FromCloneable>
@@ -366,11 +440,23 @@ namespace lightray::refl
         constexpr dyn() noexcept : _vtable{nullptr}, _obj{nullptr} {}
         constexpr dyn(std::nullptr_t) noexcept : dyn{} {}
 
-        template <typename T>
-        constexpr dyn(std::unique_ptr<T> impl) noexcept
-        :   _vtable{&detail::dyn_vtable<T, Prototype, Cloneable>},
+        // Stateless deleters other than std::default_delete, e.g. object_pool<T>::deleter, are
+        // supported. A cloneable dyn makes its copies with Deleter::clone (see dyn_cloning_deleter).
+        template <typename T, typename Deleter>
+        constexpr dyn(std::unique_ptr<T, Deleter> impl) noexcept
+        :   _vtable{detail::dyn_vtable_pointer<T, Prototype, Cloneable, Deleter>()},
             _obj(impl.release())
-        {}
+        {
+            static_assert(
+                std::is_empty_v<Deleter> && std::is_default_constructible_v<Deleter>,
+                "refl::dyn: the deleter is not stored but default constructed when needed, so it must be empty and default constructible"
+            );
+            static_assert(
+                !Cloneable || std::is_same_v<Deleter, std::default_delete<T>> || detail::dyn_cloning_deleter<Deleter, T>,
+                "refl::dyn: a cloneable dyn copies its object, so a deleter other than std::default_delete<T> must provide "
+                "static clone(const T&) -> T*, which allocates the copy where the deleter frees it"
+            );
+        }
 
         constexpr dyn(const dyn& other) requires Cloneable
         :   _vtable{other._vtable},
@@ -433,7 +519,7 @@ namespace lightray::refl
         constexpr auto on_proxy_invoked(auto info, auto&&... args)       & -> decltype(auto)
         {
             return std::visit([&](auto& vtable) {
-                return vtable->template get<info.name()>()(
+                return vtable->template get<mtp::intern(info.name())>()(
                     mtp::void_ref_ptr<mtp::traits::lvalue_traits>{_obj},
                     std::forward<decltype(args)>(args)...
                 );
@@ -443,7 +529,7 @@ namespace lightray::refl
         constexpr auto on_proxy_invoked(auto info, auto&&... args) const & -> decltype(auto)
         {
             return std::visit([&](auto& vtable) {
-                return vtable->template get<info.name()>()(
+                return vtable->template get<mtp::intern(info.name())>()(
                     mtp::void_ref_ptr<mtp::traits::const_lvalue_traits>{_obj},
                     std::forward<decltype(args)>(args)...
                 );
@@ -453,7 +539,7 @@ namespace lightray::refl
         constexpr auto on_proxy_invoked(auto info, auto&&... args)       && -> decltype(auto)
         {
             return std::visit([&](auto& vtable) {
-                return vtable->template get<info.name()>()(
+                return vtable->template get<mtp::intern(info.name())>()(
                     mtp::void_ref_ptr<mtp::traits::rvalue_traits>{_obj},
                     std::forward<decltype(args)>(args)...
                 );
@@ -463,7 +549,7 @@ namespace lightray::refl
         constexpr auto on_proxy_invoked(auto info, auto&&... args) const && -> decltype(auto)
         {
             return std::visit([&](auto& vtable) {
-                return vtable->template get<info.name()>()(
+                return vtable->template get<mtp::intern(info.name())>()(
                     mtp::void_ref_ptr<mtp::traits::const_rvalue_traits>{_obj},
                     std::forward<decltype(args)>(args)...
                 );
@@ -473,3 +559,37 @@ namespace lightray::refl
     }; // struct dyn
 
 } // namespace lightray::refl
+
+
+/*
+ * Declares that the vtable used by dyn<Prototype, Cloneable> to hold a
+ * std::unique_ptr<Target, Deleter> is instantiated by LIGHTRAY_REFL_DYN_INSTANTIATE in
+ * exactly one translation unit. Other translation units constructing such a dyn then only
+ * reference it, instead of each instantiating the vtable and all of its thunks.
+ * Cloneable defaults to false, and Deleter to std::default_delete<Target>.
+ *
+ * Must be used at global scope, before any such dyn is constructed, and be seen by every
+ * translation unit that constructs one, including the instantiating one. It is best placed
+ * in the header declaring Target. For example:
+ *
+ *  // shape.hpp
+ *  LIGHTRAY_REFL_DYN_EXTERN(shape_prototype, circle)
+ *  LIGHTRAY_REFL_DYN_EXTERN(shape_prototype, circle, true)
+ *
+ *  // shape.cpp
+ *  LIGHTRAY_REFL_DYN_INSTANTIATE(shape_prototype, circle)
+ *  LIGHTRAY_REFL_DYN_INSTANTIATE(shape_prototype, circle, true)
+ *
+ * Arguments containing commas must be parenthesized or aliased.
+ */
+#define LIGHTRAY_REFL_DYN_EXTERN(prototype, target, ...) \
+    template <> \
+    constexpr bool ::lightray::refl::detail::dyn_vtable_is_extern<target, prototype __VA_OPT__(,) __VA_ARGS__> = true; \
+    extern template struct ::lightray::refl::detail::dyn_extern_vtable<target, prototype __VA_OPT__(,) __VA_ARGS__>;
+
+/*
+ * Instantiates the vtable declared by LIGHTRAY_REFL_DYN_EXTERN with the same arguments.
+ * Must be used at global scope, in exactly one translation unit.
+ */
+#define LIGHTRAY_REFL_DYN_INSTANTIATE(prototype, target, ...) \
+    template struct ::lightray::refl::detail::dyn_extern_vtable<target, prototype __VA_OPT__(,) __VA_ARGS__>;
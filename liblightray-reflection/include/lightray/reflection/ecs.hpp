@@ -0,0 +1,526 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <lightray/metaprogramming/type_pack.hpp>
+#include <lightray/metaprogramming/value_pack.hpp>
+
+#include "type_info.hpp"
+
+
+/*
+ * Entity-component storage for reflected component types.
+ *
+ * Entities with the same set of component types share an archetype, which stores each of these
+ * component types in a column of its own (structure of arrays), so that a view over some
+ * component types iterates contiguous arrays of each, one archetype at a time.
+ *
+ * Adding or removing a component moves the entity's components to the archetype of its new set
+ * of component types. This invalidates references to the components of the entity moved, and of
+ * the entity which takes its place, so the set of component types of entities must not be changed
+ * while iterating a view.
+ */
+namespace lightray::refl::ecs
+{
+    struct entity
+    {
+        std::uint32_t index;
+        std::uint32_t generation;
+
+        constexpr auto operator==(const entity&) const noexcept -> bool = default;
+
+    }; // struct entity
+
+    using component_id = std::uint32_t;
+
+    namespace detail
+    {
+        // Type-erased operations of a component type, registered from type_info_<T>.
+        struct component_ops
+        {
+            component_id id;
+            std::size_t size;
+            std::size_t alignment;
+            std::string_view name;
+
+            // Move-constructs *dst from *src, and destroys *src.
+            void (*relocate)(void* dst, void* src);
+            void (*destroy)(void* object);
+
+        }; // struct component_ops
+
+        inline constinit std::atomic<component_id> next_component_id = 0;
+
+        template <reflected T>
+        constexpr auto component_name = type_info_<T>.name();
+
+        template <reflected T>
+        inline const component_ops component_ops_of{
+            next_component_id.fetch_add(1, std::memory_order_relaxed),
+            sizeof(T),
+            alignof(T),
+            std::string_view{component_name<T>.c_str()},
+            +[](void* dst, void* src) {
+                std::construct_at(static_cast<T*>(dst), std::move(*static_cast<T*>(src)));
+                std::destroy_at(static_cast<T*>(src));
+            },
+            +[](void* object) { std::destroy_at(static_cast<T*>(object)); }
+        };
+
+        struct column
+        {
+            const component_ops* ops;
+            std::byte* data = nullptr;
+
+            auto at(std::size_t row) const noexcept -> void*
+            {
+                return data + row * ops->size;
+            }
+
+        }; // struct column
+
+        struct archetype
+        {
+            std::vector<component_id> components;
+            std::vector<column> columns;
+            std::vector<entity> entities;
+            std::size_t capacity = 0;
+
+            explicit archetype(std::vector<const component_ops*> ops)
+            {
+                std::ranges::sort(ops, {}, &component_ops::id);
+                for (const auto* op : ops)
+                {
+                    components.push_back(op->id);
+                    columns.push_back({op});
+                }
+            }
+
+            archetype(const archetype&) = delete;
+            auto operator=(const archetype&) -> archetype& = delete;
+
+            ~archetype()
+            {
+                for (auto& c : columns)
+                {
+                    for (std::size_t row = 0; row < entities.size(); ++row)
+                        c.ops->destroy(c.at(row));
+                    ::operator delete(c.data, std::align_val_t{c.ops->alignment});
+                }
+            }
+
+            auto size() const noexcept -> std::size_t
+            {
+                return entities.size();
+            }
+
+            auto find(component_id id) noexcept -> column*
+            {
+                const auto it = std::ranges::lower_bound(components, id);
+                return it != components.end() && *it == id ? &columns[it - components.begin()] : nullptr;
+            }
+
+            // Appends a row for e, whose components are left for the caller to construct.
+            auto push(entity e) -> std::size_t
+            {
+                if (entities.size() == capacity)
+                {
+                    const auto new_capacity = std::max<std::size_t>(16, capacity * 2);
+                    for (auto& c : columns)
+                    {
+                        auto* data = static_cast<std::byte*>(
+                            ::operator new(new_capacity * c.ops->size, std::align_val_t{c.ops->alignment})
+                        );
+                        for (std::size_t row = 0; row < entities.size(); ++row)
+                            c.ops->relocate(data + row * c.ops->size, c.at(row));
+
+                        ::operator delete(c.data, std::align_val_t{c.ops->alignment});
+                        c.data = data;
+                    }
+                    capacity = new_capacity;
+                }
+
+                entities.push_back(e);
+                return entities.size() - 1;
+            }
+
+            // Removes the last row, whose components were destroyed or never constructed.
+            auto pop() noexcept -> void
+            {
+                entities.pop_back();
+            }
+
+            // Fills row, whose components were destroyed or relocated, with the last row.
+            // Returns the entity moved into row, if any.
+            auto fill(std::size_t row) noexcept -> const entity*
+            {
+                const auto last = entities.size() - 1;
+                if (row != last)
+                {
+                    for (auto& c : columns)
+                        c.ops->relocate(c.at(row), c.at(last));
+                    entities[row] = entities[last];
+                }
+                entities.pop_back();
+                return row != last ? &entities[row] : nullptr;
+            }
+
+        }; // struct archetype
+
+    } // namespace detail
+
+    /*
+     * The identifier of component type T, assigned on first use.
+     */
+    template <reflected T>
+    auto component_id_of() noexcept -> component_id
+    {
+        return detail::component_ops_of<T>.id;
+    }
+
+    class registry;
+
+    /*
+     * The entities of a registry which have all of the components Cs..., at the time the view
+     * was created.
+     */
+    template <reflected... Cs>
+    class view
+    {
+    private:
+        friend class registry;
+
+        struct table
+        {
+            detail::archetype* archetype;
+            std::tuple<Cs*...> columns;
+
+        }; // struct table
+
+        std::vector<table> _tables;
+        std::size_t _size = 0;
+
+        template <typename Fn>
+        static auto invoke(Fn& fn, const table& t, std::size_t first, std::size_t last) -> void
+        {
+            std::apply([&](Cs*... columns) {
+                const auto* entities = t.archetype->entities.data();
+                for (auto row = first; row < last; ++row)
+                {
+                    if constexpr (std::invocable<Fn&, entity, Cs&...>)
+                        fn(entities[row], columns[row]...);
+                    else
+                        fn(columns[row]...);
+                }
+            }, t.columns);
+        }
+
+    public:
+        /*
+         * The number of entities in the view.
+         */
+        auto size() const noexcept -> std::size_t
+        {
+            return _size;
+        }
+
+        /*
+         * Calls fn(e, cs...) or fn(cs...) for each entity e and its components cs... .
+         */
+        template <typename Fn>
+        auto for_each(Fn&& fn) const -> void
+        {
+            for (const auto& t : _tables)
+                invoke(fn, t, 0, t.archetype->size());
+        }
+
+        /*
+         * Calls fn(entities, columns...) once per archetype, with a span of its entities and
+         * a span of each of its columns of Cs..., e.g. to run a vectorized kernel over them.
+         */
+        template <typename Fn>
+        auto for_each_chunk(Fn&& fn) const -> void
+        {
+            for (const auto& t : _tables)
+            {
+                const auto n = t.archetype->size();
+                std::apply([&](Cs*... columns) {
+                    fn(std::span<const entity>(t.archetype->entities), std::span<Cs>(columns, n)...);
+                }, t.columns);
+            }
+        }
+
+        /*
+         * As for_each, but splits the entities into Tasks ranges of about the same size, which
+         * executor runs concurrently (see mtp::work_stealing_executor). fn must be safe to call
+         * concurrently for different entities.
+         */
+        template <std::size_t Tasks = 64, typename Executor, typename Fn>
+        auto parallel_for_each(Executor& executor, Fn&& fn) const -> void
+        {
+            mtp::make_index_sequence<Tasks>.parallel_for_each(executor, [&]<std::size_t I>{
+                const auto first = _size * I / Tasks;
+                const auto last = _size * (I + 1) / Tasks;
+
+                std::size_t offset = 0;
+                for (const auto& t : _tables)
+                {
+                    const auto n = t.archetype->size();
+                    if (offset + n > first && offset < last)
+                        invoke(fn, t, std::max(first, offset) - offset, std::min(last, offset + n) - offset);
+                    offset += n;
+                    if (offset >= last)
+                        break;
+                }
+            });
+        }
+
+    }; // class view
+
+    /*
+     * Owns entities and their components.
+     * Throws std::out_of_range when given an entity which was destroyed, or accessing
+     * a component an entity does not have.
+     */
+    class registry
+    {
+    private:
+        struct record
+        {
+            detail::archetype* archetype;
+            std::size_t row;
+            std::uint32_t generation;
+
+        }; // struct record
+
+        std::vector<record> _records;
+        std::vector<std::uint32_t> _free;
+        std::vector<std::unique_ptr<detail::archetype>> _archetypes;
+        std::map<std::vector<component_id>, detail::archetype*> _archetype_index;
+
+        auto archetype_of(std::vector<const detail::component_ops*> ops) -> detail::archetype*
+        {
+            std::ranges::sort(ops, {}, &detail::component_ops::id);
+
+            std::vector<component_id> key;
+            for (const auto* op : ops)
+                key.push_back(op->id);
+
+            if (const auto it = _archetype_index.find(key); it != _archetype_index.end())
+                return it->second;
+
+            auto& a = _archetypes.emplace_back(std::make_unique<detail::archetype>(std::move(ops)));
+            _archetype_index.emplace(std::move(key), a.get());
+            return a.get();
+        }
+
+        auto record_of(entity e) -> record&
+        {
+            if (!alive(e))
+                throw std::out_of_range("refl::ecs::registry: entity is not alive");
+            return _records[e.index];
+        }
+
+        auto fill(detail::archetype& a, std::size_t row) noexcept -> void
+        {
+            if (const auto* moved = a.fill(row))
+                _records[moved->index].row = row;
+        }
+
+        // Moves the components of e which the archetype to has to a new row of to, destroys the
+        // others, and returns the new row. The components to has and e had not are left unconstructed.
+        auto move_to(entity e, record& r, detail::archetype& to) -> std::size_t
+        {
+            auto& from = *r.archetype;
+            const auto row = to.push(e);
+            for (auto& c : from.columns)
+            {
+                if (auto* target = to.find(c.ops->id))
+                    c.ops->relocate(target->at(row), c.at(r.row));
+                else
+                    c.ops->destroy(c.at(r.row));
+            }
+            fill(from, r.row);
+
+            r.archetype = &to;
+            r.row = row;
+            return row;
+        }
+
+        template <reflected C>
+        static auto ops_with(const detail::archetype& a) -> std::vector<const detail::component_ops*>
+        {
+            std::vector<const detail::component_ops*> ops;
+            for (const auto& c : a.columns)
+                ops.push_back(c.ops);
+            ops.push_back(&detail::component_ops_of<C>);
+            return ops;
+        }
+
+    public:
+        registry() = default;
+        registry(const registry&) = delete;
+        auto operator=(const registry&) -> registry& = delete;
+
+        /*
+         * Creates an entity with the given components, which must be of distinct types.
+         * If moving a component throws, the registry is left as it was.
+         */
+        template <reflected... Cs>
+        auto create(Cs... components) -> entity
+        {
+            static_assert(mtp::type_pack<Cs...>.unique().size() == sizeof...(Cs),
+                "refl::ecs::registry::create: the component types must be distinct");
+
+            auto* a = archetype_of({&detail::component_ops_of<Cs>...});
+
+            // The index is only taken from _free, or _records grown, once the components are built.
+            const auto recycled = !_free.empty();
+            if (!recycled)
+                _records.reserve(_records.size() + 1);
+            const auto e = recycled
+                ? entity{_free.back(), _records[_free.back()].generation}
+                : entity{static_cast<std::uint32_t>(_records.size()), 0};
+
+            const auto row = a->push(e);
+            std::size_t constructed = 0;
+            try
+            {
+                ((std::construct_at(static_cast<Cs*>(a->find(component_id_of<Cs>())->at(row)), std::move(components)), ++constructed), ...);
+            }
+            catch (...)
+            {
+                std::size_t i = 0;
+                ((i++ < constructed ? std::destroy_at(static_cast<Cs*>(a->find(component_id_of<Cs>())->at(row))) : void()), ...);
+                a->pop();
+                throw;
+            }
+
+            if (recycled)
+                _free.pop_back();
+            else
+                _records.push_back({});
+            _records[e.index] = {a, row, e.generation};
+            return e;
+        }
+
+        auto destroy(entity e) -> void
+        {
+            auto& r = record_of(e);
+            for (auto& c : r.archetype->columns)
+                c.ops->destroy(c.at(r.row));
+            fill(*r.archetype, r.row);
+
+            r = {nullptr, 0, r.generation + 1};
+            _free.push_back(e.index);
+        }
+
+        auto alive(entity e) const noexcept -> bool
+        {
+            return e.index < _records.size()
+                && _records[e.index].archetype
+                && _records[e.index].generation == e.generation;
+        }
+
+        /*
+         * The number of entities alive.
+         */
+        auto size() const noexcept -> std::size_t
+        {
+            return _records.size() - _free.size();
+        }
+
+        template <reflected C>
+        auto has(entity e) -> bool
+        {
+            return record_of(e).archetype->find(component_id_of<C>()) != nullptr;
+        }
+
+        template <reflected C>
+        auto try_get(entity e) -> C*
+        {
+            auto& r = record_of(e);
+            auto* c = r.archetype->find(component_id_of<C>());
+            return c ? static_cast<C*>(c->at(r.row)) : nullptr;
+        }
+
+        template <reflected C>
+        auto get(entity e) -> C&
+        {
+            if (auto* component = try_get<C>(e))
+                return *component;
+            throw std::out_of_range(
+                "refl::ecs::registry: entity has no component " + std::string(detail::component_ops_of<C>.name)
+            );
+        }
+
+        /*
+         * Adds component to e, or assigns it if e already has a component of type C.
+         */
+        template <reflected C>
+        auto emplace(entity e, C component) -> C&
+        {
+            auto& r = record_of(e);
+            if (auto* existing = r.archetype->find(component_id_of<C>()))
+                return *static_cast<C*>(existing->at(r.row)) = std::move(component);
+
+            auto* to = archetype_of(ops_with<C>(*r.archetype));
+            const auto row = move_to(e, r, *to);
+            return *std::construct_at(static_cast<C*>(to->find(component_id_of<C>())->at(row)), std::move(component));
+        }
+
+        /*
+         * Removes the component of type C from e, if it has one.
+         */
+        template <reflected C>
+        auto remove(entity e) -> void
+        {
+            auto& r = record_of(e);
+            if (!r.archetype->find(component_id_of<C>()))
+                return;
+
+            std::vector<const detail::component_ops*> ops;
+            for (const auto& c : r.archetype->columns)
+                if (c.ops->id != component_id_of<C>())
+                    ops.push_back(c.ops);
+
+            move_to(e, r, *archetype_of(std::move(ops)));
+        }
+
+        /*
+         * The entities which have all of the components Cs... .
+         * The view is invalidated by any change to the set of component types of an entity.
+         */
+        template <reflected... Cs>
+        auto view() -> ecs::view<Cs...>
+        {
+            ecs::view<Cs...> result;
+            for (const auto& a : _archetypes)
+            {
+                if (a->size() == 0 || (... || !a->find(component_id_of<Cs>())))
+                    continue;
+
+                result._tables.push_back({a.get(), {static_cast<Cs*>(static_cast<void*>(a->find(component_id_of<Cs>())->data))...}});
+                result._size += a->size();
+            }
+            return result;
+        }
+
+    }; // class registry
+
+} // namespace lightray::refl::ecs
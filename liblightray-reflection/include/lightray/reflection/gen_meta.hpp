@@ -385,6 +385,8 @@
 #define LIGHTRAY_REFL_MACRO_MEMBER_type LIGHTRAY_REFL_MEMBER_TYPE
 
 
+// offset() is a template so that it is only checked when used, i.e. for the non-static data members of types without
+// virtual bases. offsetof is only conditionally-supported on non-standard-layout types, which g++ and clang do support.
 #define LIGHTRAY_REFL_MEMBER_VAR(v_id) \
     static constexpr auto category() noexcept -> ::lightray::refl::meta_category \
     { return ::lightray::refl::meta_category::variable; } \
@@ -396,6 +398,15 @@
             return &DeclaringType::v_id; \
         else \
             return &DeclaringType::template v_id<TArgs...>; \
+    } \
+    \
+    template <typename Declaring = DeclaringType> \
+    static constexpr auto offset() noexcept -> ::std::ptrdiff_t \
+    { \
+        _Pragma("GCC diagnostic push") \
+        _Pragma("GCC diagnostic ignored \"-Winvalid-offsetof\"") \
+        return __builtin_offsetof(Declaring, v_id); \
+        _Pragma("GCC diagnostic pop") \
     }
 #define LIGHTRAY_REFL_MACRO_MEMBER_var LIGHTRAY_REFL_MEMBER_VAR
 
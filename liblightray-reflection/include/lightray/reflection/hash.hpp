@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+#include <lightray/metaprogramming/hash.hpp>
+
+#include "layout.hpp"
+#include "meta_extraction.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    namespace detail
+    {
+        template <typename T>
+        concept hash_bytewise_contiguous_range =
+            std::ranges::contiguous_range<const T>
+         && std::ranges::sized_range<const T>
+         && is_bytewise_v<std::ranges::range_value_t<const T>>;
+
+        template <typename T>
+        auto hash_value(const T& value, std::uint64_t seed) noexcept -> std::uint64_t
+        {
+            if constexpr (is_bytewise_v<T>)
+            {
+                return mtp::hash_bytes(std::addressof(value), sizeof(T), seed);
+            }
+            else if constexpr (reflected<T>)
+            {
+                type_info_<T>.data_members().for_each([&]<auto Member>{
+                    seed = hash_value(Member.invoke(value), seed);
+                });
+                return seed;
+            }
+            else if constexpr (hash_bytewise_contiguous_range<T>)
+            {
+                return mtp::hash_bytes(
+                    std::ranges::data(value),
+                    std::ranges::size(value) * sizeof(std::ranges::range_value_t<const T>),
+                    seed
+                );
+            }
+            else if constexpr (std::ranges::input_range<const T>)
+            {
+                std::uint64_t count = 0;
+                for (const auto& element : value)
+                {
+                    seed = hash_value(element, seed);
+                    ++count;
+                }
+                return mtp::mix_hash(seed, count);
+            }
+            else
+            {
+                return mtp::mix_hash(seed, std::hash<T>{}(value));
+            }
+        }
+
+    } // namespace detail
+
+    /*
+     * A hasher for reflected types, usable as the Hash parameter of unordered containers.
+     *
+     * Each reflected non-static data member is hashed in declaration order and mixed
+     * into the running seed. Members are hashed as following:
+     *  - reflected types recursively with the same scheme,
+     *  - contiguous ranges of bytewise hashable elements (e.g. std::string) in a single pass,
+     *  - other ranges element by element,
+     *  - everything else using std::hash.
+     *
+     * If is_bytewise_v<T> is true, the whole object is hashed in one pass instead.
+     * Unreflected data members never contribute to the hash.
+     */
+    template <reflected T>
+    struct hash
+    {
+        auto operator()(const T& value) const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(detail::hash_value(value, 0));
+        }
+
+    }; // struct hash
+
+} // namespace lightray::refl
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+#include <lightray/metaprogramming/type.hpp>
+
+#include "meta_extraction.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    namespace detail
+    {
+        template <auto Member>
+        using layout_member_type_t = mtp::splice::type::decl_t<Member.type()>;
+
+        // Layouts are only reported for types which may be copied as raw bytes.
+        template <reflected T>
+        constexpr auto layout_has_constexpr_offsets() noexcept -> bool
+        {
+            return std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>;
+        }
+
+        // __builtin_offsetof needs the offset() LIGHTRAY_REFL_TYPE gives each data member, and T to have no
+        // virtual bases, which standard-layout and trivially copyable types cannot have.
+        template <reflected T>
+        constexpr auto layout_has_builtin_offsets() noexcept -> bool
+        {
+            if constexpr (!std::is_standard_layout_v<T> && !std::is_trivially_copyable_v<T>)
+                return false;
+            else
+                return type_info_<T>.data_members().apply([]<auto... Members>{
+                    return (... && requires { member_meta_type_t<T, Members.index()>::offset(); });
+                });
+        }
+
+        template <reflected T> requires (layout_has_builtin_offsets<T>())
+        constexpr auto layout_member_offsets() noexcept -> auto
+        {
+            return type_info_<T>.data_members().apply([]<auto... Members>{
+                return std::array<std::ptrdiff_t, sizeof...(Members)>{member_meta_type_t<T, Members.index()>::offset()...};
+            });
+        }
+
+        template <reflected T>
+        constexpr auto layout_member_sizes() noexcept -> auto
+        {
+            return type_info_<T>.data_members().apply([]<auto... Members>{
+                return std::array<std::size_t, sizeof...(Members)>{sizeof(layout_member_type_t<Members>)...};
+            });
+        }
+
+        template <reflected T>
+        constexpr auto layout_is_padding_free() noexcept -> bool
+        {
+            if constexpr (!layout_has_constexpr_offsets<T>())
+                return false;
+            else
+            {
+                constexpr auto offsets = layout_member_offsets<T>();
+                constexpr auto sizes = layout_member_sizes<T>();
+
+                std::size_t expected_offset = 0;
+                for (std::size_t i = 0; i < offsets.size(); ++i)
+                {
+                    if (offsets[i] != static_cast<std::ptrdiff_t>(expected_offset))
+                        return false;
+                    expected_offset += sizes[i];
+                }
+                return expected_offset == sizeof(T);
+            }
+        }
+
+        template <typename T>
+        constexpr auto layout_is_bytewise() noexcept -> bool;
+
+    } // namespace detail
+
+    /*
+     * The offsets of the reflected data members of T, in declaration order, as a constexpr
+     * std::array<std::ptrdiff_t, N>, e.g. refl::member_offsets<vec3>[1] == offsetof(vec3, y).
+     *
+     * Each offset is a __builtin_offsetof, so T must be standard-layout or trivially copyable,
+     * neither of which may have virtual bases.
+     */
+    template <reflected T>
+    requires (detail::layout_has_builtin_offsets<T>())
+    constexpr auto member_offsets = detail::layout_member_offsets<T>();
+
+    /*
+     * True if the reflected data members of T are laid out back-to-back, in declaration order,
+     * and cover every byte of T. i.e. T has neither padding nor unreflected data.
+     *
+     * This is proven from the member offsets (member_offsets) and sizes, and is therefore only
+     * computed for trivially copyable, standard-layout types. It is false for any other type.
+     */
+    template <reflected T>
+    constexpr bool is_padding_free_v = detail::layout_is_padding_free<T>();
+
+    /*
+     * True if two objects of type T hold equal (reflected) values exactly when their object
+     * representations are equal, so that they may be hashed and compared as raw bytes.
+     *
+     * For reflected types, this requires is_padding_free_v<T> and every data member type to be
+     * bytewise as well. For other types, this is std::has_unique_object_representations_v<T>.
+     */
+    template <typename T>
+    constexpr bool is_bytewise_v = detail::layout_is_bytewise<T>();
+
+    namespace detail
+    {
+        template <typename T>
+        constexpr auto layout_is_bytewise() noexcept -> bool
+        {
+            if constexpr (reflected<T>)
+            {
+                if constexpr (!is_padding_free_v<T>)
+                    return false;
+                else
+                    return type_info_<T>.data_members().apply([]<auto... Members>{
+                        return (... && is_bytewise_v<layout_member_type_t<Members>>);
+                    });
+            }
+            else
+                return std::has_unique_object_representations_v<T>;
+        }
+
+    } // namespace detail
+
+    /*
+     * The layout of one reflected data member, see layout_info.
+     * padding is the number of bytes between the end of this member and the start of the next one,
+     * or the end of the object for the last member.
+     */
+    struct member_layout
+    {
+        std::string_view name;
+        std::size_t index;
+        std::ptrdiff_t offset;
+        std::size_t size;
+        std::size_t alignment;
+        std::size_t padding;
+
+    }; // struct member_layout
+
+    namespace detail
+    {
+        template <auto Member>
+        constexpr auto layout_member_name = Member.name();
+
+        template <reflected T>
+        constexpr auto layout_members() noexcept -> auto
+        {
+            constexpr auto offsets = layout_member_offsets<T>();
+
+            auto result = type_info_<T>.data_members().apply([]<auto... Members>{
+                return std::array<member_layout, sizeof...(Members)>{member_layout{
+                    std::string_view{layout_member_name<Members>.c_str()},
+                    Members.index(),
+                    0,
+                    sizeof(layout_member_type_t<Members>),
+                    alignof(layout_member_type_t<Members>),
+                    0
+                }...};
+            });
+
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                result[i].offset = offsets[i];
+                const auto next_offset = i + 1 < result.size() ? offsets[i + 1] : static_cast<std::ptrdiff_t>(sizeof(T));
+                result[i].padding = static_cast<std::size_t>(next_offset - offsets[i]) - result[i].size;
+            }
+            return result;
+        }
+
+        // Declaration positions sorted by decreasing alignment, ties kept in declaration order.
+        template <reflected T>
+        constexpr auto layout_optimal_order() noexcept -> auto
+        {
+            constexpr auto members = layout_members<T>();
+
+            std::array<std::size_t, members.size()> order{};
+            for (std::size_t i = 0; i < order.size(); ++i)
+            {
+                std::size_t j = i;
+                for (; j > 0 && members[order[j - 1]].alignment < members[i].alignment; --j)
+                    order[j] = order[j - 1];
+                order[j] = i;
+            }
+            return order;
+        }
+
+        template <reflected T>
+        constexpr auto layout_optimal_size() noexcept -> std::size_t
+        {
+            constexpr auto members = layout_members<T>();
+
+            std::size_t size = 0;
+            for (auto i : layout_optimal_order<T>())
+            {
+                const auto& member = members[i];
+                size = (size + member.alignment - 1) / member.alignment * member.alignment + member.size;
+            }
+            return (size + alignof(T) - 1) / alignof(T) * alignof(T);
+        }
+
+    } // namespace detail
+
+    /*
+     * The compile-time layout of the reflected data members of T, in declaration order.
+     *
+     * Offsets are those of member_offsets. Like is_padding_free_v, T must be trivially copyable
+     * and standard-layout.
+     *
+     * padding_bytes counts every byte of T not covered by a reflected data member.
+     * optimal_order lists the declaration positions (indices into members) sorted by decreasing
+     * alignment, which minimizes padding, and optimal_size is the size of T in that order.
+     */
+    template <reflected T>
+    requires (detail::layout_has_constexpr_offsets<T>())
+    struct layout_info
+    {
+        static constexpr std::size_t size = sizeof(T);
+        static constexpr std::size_t alignment = alignof(T);
+        static constexpr auto members = detail::layout_members<T>();
+        static constexpr std::size_t padding_bytes = [] {
+            std::size_t covered = 0;
+            for (const auto& member : members)
+                covered += member.size;
+            return size - covered;
+        } ();
+        static constexpr auto optimal_order = detail::layout_optimal_order<T>();
+        static constexpr std::size_t optimal_size = detail::layout_optimal_size<T>();
+
+    }; // struct layout_info
+
+    /*
+     * The number of bytes of T not covered by a reflected data member, e.g.
+     *   static_assert(refl::padding_bytes<packet> == 0);
+     */
+    template <reflected T>
+    constexpr std::size_t padding_bytes = layout_info<T>::padding_bytes;
+
+} // namespace lightray::refl
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+
+#include "layout.hpp"
+#include "meta_extraction.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    /*
+     * Writes the layout_info of T to os as a table, one row per reflected data member:
+     *
+     *   trade: size 32, align 8, padding 2, optimal size 32
+     *     offset  size  align  padding  member
+     *          0     8      8        0  id
+     *     ...
+     */
+    template <reflected T>
+    auto write_layout(std::ostream& os) -> std::ostream&
+    {
+        using info = layout_info<T>;
+
+        os << type_info_<T>.name().c_str()
+           << ": size " << info::size
+           << ", align " << info::alignment
+           << ", padding " << info::padding_bytes
+           << ", optimal size " << info::optimal_size << '\n';
+
+        os << "  " << std::setw(6) << "offset"
+           << "  " << std::setw(4) << "size"
+           << "  " << std::setw(5) << "align"
+           << "  " << std::setw(7) << "padding"
+           << "  member\n";
+
+        for (const auto& member : info::members)
+            os << "  " << std::setw(6) << member.offset
+               << "  " << std::setw(4) << member.size
+               << "  " << std::setw(5) << member.alignment
+               << "  " << std::setw(7) << member.padding
+               << "  " << member.name << '\n';
+
+        return os;
+    }
+
+    /*
+     * Writes the layout of each of Ts to os, see write_layout.
+     * Returns the total number of bytes that reordering members would save across Ts,
+     * which a build step can compare against a budget to catch layout regressions.
+     */
+    template <reflected... Ts>
+    auto write_layout_report(std::ostream& os) -> std::size_t
+    {
+        (write_layout<Ts>(os << '\n'), ...);
+        return (std::size_t{0} + ... + (layout_info<Ts>::size - layout_info<Ts>::optimal_size));
+    }
+
+} // namespace lightray::refl
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <lightray/metaprogramming/string_id.hpp>
+#include <lightray/metaprogramming/value_pack.hpp>
+
+#include "meta_category.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    namespace detail
+    {
+        // The name of member M, with static storage so that views of it are constant expressions.
+        template <auto M>
+        constexpr auto meta_cache_name = M.name();
+
+        template <auto M>
+        constexpr auto meta_cache_is_data_member() noexcept -> bool
+        {
+            if constexpr (M.category() != meta_category::variable)
+                return false;
+            else
+                return std::is_member_object_pointer_v<decltype(M.pointer())>;
+        }
+
+        // The indices of the elements of flags which equal flag, in order.
+        template <auto Flags, bool Flag>
+        constexpr auto meta_cache_indices() noexcept -> auto
+        {
+            constexpr auto count = [] {
+                std::size_t result = 0;
+                for (bool f : Flags)
+                    result += f == Flag;
+                return result;
+            }();
+
+            std::array<std::size_t, count> result{};
+            for (std::size_t i = 0, j = 0; i < Flags.size(); ++i)
+                if (Flags[i] == Flag)
+                    result[j++] = i;
+            return result;
+        }
+
+        template <auto Members, auto Indices>
+        constexpr auto meta_cache_select() noexcept -> auto
+        {
+            return []<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                return mtp::value_pack<Members.template get<Indices[Is]>()...>;
+            } (std::make_index_sequence<Indices.size()>{});
+        }
+
+    } // namespace detail
+
+    /*
+     * Facts about the members of reflected type T, computed once per T.
+     *
+     * type_info_<T>.members() is a value_pack, and every query on it, e.g. finding a member
+     * by name with find_if, instantiates the query once per member at each place it is made.
+     * meta_cache instead holds the names, categories and kinds of the members in constexpr
+     * arrays, so that finding a member is a constant evaluation which instantiates nothing.
+     *
+     * Author: P. Lutchanont
+     */
+    template <reflected T>
+    struct meta_cache
+    {
+        static constexpr auto members = type_info_<T>.members();
+
+        static constexpr std::size_t member_count = members.size();
+
+        static constexpr auto member_names = members.apply([]<auto... Members>{
+            return std::array<std::string_view, member_count>{
+                std::string_view(detail::meta_cache_name<Members>.c_str())...
+            };
+        });
+
+        // The interned names of the members, see mtp::intern.
+        static constexpr auto member_ids = members.apply([]<auto... Members>{
+            return std::array<mtp::string_id, member_count>{mtp::intern(Members.name())...};
+        });
+
+        static constexpr auto member_categories = members.apply([]<auto... Members>{
+            return std::array<meta_category, member_count>{Members.category()...};
+        });
+
+        // Whether each member is a non-static variable member.
+        static constexpr auto member_is_data = members.apply([]<auto... Members>{
+            return std::array<bool, member_count>{detail::meta_cache_is_data_member<Members>()...};
+        });
+
+        // The indices in members of the non-static variable members, and of the others.
+        static constexpr auto data_member_indices = detail::meta_cache_indices<member_is_data, true>();
+        static constexpr auto other_member_indices = detail::meta_cache_indices<member_is_data, false>();
+
+        // Same as type_info_<T>.data_members().
+        static constexpr auto data_members = detail::meta_cache_select<members, data_member_indices>();
+
+        // Same as the members which are not in data_members.
+        static constexpr auto other_members = detail::meta_cache_select<members, other_member_indices>();
+
+        // Returns the index in members of the member named name, or member_count if there is none.
+        static constexpr auto index_of(std::string_view name) noexcept -> std::size_t
+        {
+            std::size_t i = 0;
+            while (i < member_count && member_names[i] != name)
+                ++i;
+            return i;
+        }
+
+        // Returns the index in members of the member whose interned name is id, or member_count if there is none.
+        static constexpr auto index_of(mtp::string_id id) noexcept -> std::size_t
+        {
+            std::size_t i = 0;
+            while (i < member_count && member_ids[i] != id)
+                ++i;
+            return i;
+        }
+
+        // Returns the index in data_members of the data member named name, or data_members.size() if there is none.
+        static constexpr auto data_index_of(std::string_view name) noexcept -> std::size_t
+        {
+            std::size_t i = 0;
+            while (i < data_member_indices.size() && member_names[data_member_indices[i]] != name)
+                ++i;
+            return i;
+        }
+
+        // Returns the member named name, e.g. meta_cache<T>::member<"x">().
+        template <mtp::fixed_string Name>
+        static constexpr auto member() noexcept -> auto
+        {
+            constexpr auto index = index_of(Name.c_str());
+            static_assert(index < member_count, "T has no member with this name");
+            return members.template get<index>();
+        }
+
+        // Returns the non-static variable member named name, e.g. meta_cache<T>::data_member<"x">().
+        template <mtp::fixed_string Name>
+        static constexpr auto data_member() noexcept -> auto
+        {
+            constexpr auto index = data_index_of(Name.c_str());
+            static_assert(index < data_members.size(), "T has no data member with this name");
+            return data_members.template get<index>();
+        }
+
+    }; // struct meta_cache
+
+} // namespace lightray::refl
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "deep_copy.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    /*
+     * Counters of an object_pool, summed over every thread which used it.
+     * A hit is an acquire served from the pool, and a miss one which had to allocate.
+     */
+    struct pool_statistics
+    {
+        std::uint64_t hits;
+        std::uint64_t misses;
+
+    }; // struct pool_statistics
+
+    /*
+     * A process wide pool of recycled objects of reflected type T.
+     *
+     * Released objects are not destroyed but reset (see refl::reset), so that their containers
+     * keep their capacity, and are handed out again by acquire. Each thread caches up to two
+     * magazines of magazine_size objects, so that acquire and release only take the pool's lock
+     * to exchange a whole magazine with the shared depot, once every magazine_size calls at most.
+     * Objects may be released by another thread than the one which acquired them.
+     */
+    template <reflected T>
+    requires std::is_default_constructible_v<T>
+    class object_pool
+    {
+    public:
+        static constexpr std::size_t magazine_size = 32;
+
+        struct deleter
+        {
+            auto operator()(T* object) const noexcept -> void
+            {
+                object_pool::release(object);
+            }
+
+            // Copies object into an object acquired from the pool, e.g. for a cloneable dyn.
+            static auto clone(const T& object) -> T*
+            {
+                auto copy = object_pool::acquire();
+                refl::deep_copy(object, *copy);
+                return copy.release();
+            }
+
+        }; // struct deleter
+
+        using handle = std::unique_ptr<T, deleter>;
+
+    private:
+        struct magazine
+        {
+            std::array<T*, magazine_size> objects;
+            std::size_t count = 0;
+
+        }; // struct magazine
+
+        // Written by its thread only, and read by statistics().
+        struct thread_counters
+        {
+            std::atomic<std::uint64_t> hits = 0;
+            std::atomic<std::uint64_t> misses = 0;
+
+            static auto bump(std::atomic<std::uint64_t>& counter) noexcept -> void
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+        }; // struct thread_counters
+
+        struct depot_type
+        {
+            std::mutex mutex;
+            std::vector<magazine> full;
+            std::vector<const thread_counters*> threads;
+            pool_statistics retired{};
+
+            ~depot_type()
+            {
+                for (auto& m : full)
+                    std::for_each_n(m.objects.begin(), m.count, [](T* object) { delete object; });
+            }
+
+        }; // struct depot_type
+
+        static inline depot_type depot;
+
+        struct thread_cache
+        {
+            magazine loaded;
+            magazine previous;
+            thread_counters counters;
+
+            thread_cache()
+            {
+                std::lock_guard lock(depot.mutex);
+                depot.threads.push_back(&counters);
+            }
+
+            thread_cache(const thread_cache&) = delete;
+            auto operator=(const thread_cache&) -> thread_cache& = delete;
+
+            ~thread_cache()
+            {
+                std::lock_guard lock(depot.mutex);
+                for (auto* m : {&loaded, &previous})
+                    if (m->count != 0)
+                        depot.full.push_back(*m);
+
+                depot.retired.hits += counters.hits.load(std::memory_order_relaxed);
+                depot.retired.misses += counters.misses.load(std::memory_order_relaxed);
+                std::erase(depot.threads, &counters);
+            }
+
+        }; // struct thread_cache
+
+        static auto cache() -> thread_cache&
+        {
+            static thread_local thread_cache instance;
+            return instance;
+        }
+
+    public:
+        object_pool() = delete;
+
+        /*
+         * Returns a pooled object if there is one, and a value-initialized T otherwise.
+         * Either way the object is in its default state, and returns to the pool when
+         * the handle is destroyed.
+         */
+        static auto acquire() -> handle
+        {
+            auto& c = cache();
+            if (c.loaded.count == 0)
+            {
+                if (c.previous.count != 0)
+                    std::swap(c.loaded, c.previous);
+                else
+                {
+                    std::lock_guard lock(depot.mutex);
+                    if (!depot.full.empty())
+                    {
+                        c.loaded = depot.full.back();
+                        depot.full.pop_back();
+                    }
+                }
+            }
+
+            if (c.loaded.count != 0)
+            {
+                thread_counters::bump(c.counters.hits);
+                return handle(c.loaded.objects[--c.loaded.count]);
+            }
+
+            thread_counters::bump(c.counters.misses);
+            return handle(new T());
+        }
+
+        /*
+         * Resets object and returns it to the pool. Objects which cannot be reset or pooled,
+         * because doing so throws, are deleted instead.
+         */
+        static auto release(T* object) noexcept -> void
+        {
+            if (!object)
+                return;
+
+            try
+            {
+                refl::reset(*object);
+
+                auto& c = cache();
+                if (c.loaded.count == magazine_size)
+                {
+                    if (c.previous.count == 0)
+                        std::swap(c.loaded, c.previous);
+                    else
+                    {
+                        std::lock_guard lock(depot.mutex);
+                        depot.full.push_back(c.loaded);
+                        c.loaded.count = 0;
+                    }
+                }
+                c.loaded.objects[c.loaded.count++] = object;
+            }
+            catch (...)
+            {
+                delete object;
+            }
+        }
+
+        static auto statistics() -> pool_statistics
+        {
+            std::lock_guard lock(depot.mutex);
+
+            auto result = depot.retired;
+            for (const auto* counters : depot.threads)
+            {
+                result.hits += counters->hits.load(std::memory_order_relaxed);
+                result.misses += counters->misses.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        /*
+         * Deletes the objects held by the shared depot, i.e. not cached by any thread,
+         * and returns how many were deleted.
+         */
+        static auto trim() -> std::size_t
+        {
+            std::vector<magazine> full;
+            {
+                std::lock_guard lock(depot.mutex);
+                full.swap(depot.full);
+            }
+
+            std::size_t count = 0;
+            for (auto& m : full)
+            {
+                std::for_each_n(m.objects.begin(), m.count, [](T* object) { delete object; });
+                count += m.count;
+            }
+            return count;
+        }
+
+    }; // class object_pool
+
+} // namespace lightray::refl
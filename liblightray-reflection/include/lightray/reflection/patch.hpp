@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "compare.hpp"
+#include "layout.hpp"
+#include "meta_extraction.hpp"
+#include "serialize.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    /*
+     * A delta between two values of a reflected type T, produced by refl::diff and consumed
+     * by refl::apply_patch.
+     *
+     * The encoding of a patch for a reflected type is a bitset of (member_count() + 7) / 8 bytes,
+     * where bit member_info_t::index() is set if that data member changed, followed by the new
+     * value of each changed member in declaration order. A changed member of reflected type is
+     * itself encoded as a patch, other members are encoded with refl::serialize.
+     *
+     * A patch between equal values is empty.
+     */
+    template <reflected T>
+    struct patch
+    {
+        std::vector<std::byte> bytes;
+
+        auto empty() const noexcept -> bool { return bytes.empty(); }
+
+        auto size() const noexcept -> std::size_t { return bytes.size(); }
+
+        // Returns true if the data member at the given member_info_t::index() changed.
+        auto changed(std::size_t member_index) const noexcept -> bool
+        {
+            return !empty() && (bytes[member_index / 8] & (std::byte{1} << (member_index % 8))) != std::byte{0};
+        }
+
+    }; // struct patch
+
+    namespace detail
+    {
+        template <reflected T>
+        constexpr auto patch_mask_size() noexcept -> std::size_t
+        {
+            return (type_info_<T>.member_count() + 7) / 8;
+        }
+
+        // Returns false without writing anything past the mask if nothing changed.
+        template <reflected T>
+        auto patch_write(std::vector<std::byte>& out, const T& old_value, const T& new_value) -> bool
+        {
+            const auto mask_offset = out.size();
+            out.resize(out.size() + patch_mask_size<T>());
+
+            bool changed = false;
+            type_info_<T>.data_members().for_each([&]<auto Member>{
+                const auto& old_member = Member.invoke(old_value);
+                const auto& new_member = Member.invoke(new_value);
+
+                if (compare_value_equal(old_member, new_member))
+                    return;
+
+                changed = true;
+                out[mask_offset + Member.index() / 8] |= std::byte{1} << (Member.index() % 8);
+
+                if constexpr (reflected<layout_member_type_t<Member>>)
+                    patch_write(out, old_member, new_member);
+                else
+                    serialize(out, new_member);
+            });
+            return changed;
+        }
+
+        template <reflected T>
+        auto patch_apply(std::span<const std::byte>& in, T& obj) -> void
+        {
+            constexpr auto mask_size = patch_mask_size<T>();
+            if (in.size() < mask_size)
+                throw deserialize_error("refl::apply_patch: unexpected end of input");
+
+            const auto mask = in.first(mask_size);
+            in = in.subspan(mask_size);
+
+            type_info_<T>.data_members().for_each([&]<auto Member>{
+                if ((mask[Member.index() / 8] & (std::byte{1} << (Member.index() % 8))) == std::byte{0})
+                    return;
+
+                if constexpr (reflected<layout_member_type_t<Member>>)
+                    patch_apply(in, Member.invoke(obj));
+                else
+                    deserialize(in, Member.invoke(obj));
+            });
+        }
+
+    } // namespace detail
+
+    /*
+     * Computes the patch which turns old_value into new_value. Members are compared as in refl::equal.
+     */
+    template <reflected T>
+    requires serializable_v<T>
+    auto diff(const T& old_value, const T& new_value) -> patch<T>
+    {
+        patch<T> result;
+        if (!detail::patch_write(result.bytes, old_value, new_value))
+            result.bytes.clear();
+        return result;
+    }
+
+    /*
+     * Applies p to obj, which must be equal to the old value p was computed from.
+     * Throws deserialize_error if p is malformed. T must not hold views, which would view p.
+     */
+    template <reflected T>
+    requires serializable_v<T> && (!detail::serialize_borrows_v<T>)
+    auto apply_patch(T& obj, const patch<T>& p) -> void
+    {
+        if (p.empty())
+            return;
+
+        std::span<const std::byte> in = p.bytes;
+        detail::patch_apply(in, obj);
+
+        if (!in.empty())
+            throw deserialize_error("refl::apply_patch: trailing bytes in patch");
+    }
+
+} // namespace lightray::refl
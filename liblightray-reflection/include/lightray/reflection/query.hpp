@@ -0,0 +1,535 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <lightray/metaprogramming/fixed_string.hpp>
+
+#include "layout.hpp"
+#include "meta_cache.hpp"
+#include "meta_extraction.hpp"
+#include "type_info.hpp"
+
+
+/*
+ * Filter, projection and aggregation over collections of reflected records, written as
+ * expressions over their data members, e.g.
+ *
+ *  using namespace refl::q;
+ *  auto volume = aggregate(trades, field<"price"> > 100.0 && field<"side"> == side::buy, sum(field<"qty">));
+ *
+ * Fields are resolved by name at compile time against the data members of the record type, and
+ * each query runs as a single loop in which the expressions are inlined. Logical operators
+ * evaluate both of their operands, so that a predicate compiles to no data dependent branches,
+ * unless their right operand may trap (i.e. divides), which is then only evaluated when it
+ * decides the result, as a guard like field<"n"> != 0 && field<"total"> / field<"n"> > 4 needs.
+ * Aggregates only evaluate their expression on the records the predicate accepts.
+ *
+ * Queries run either over a range of records, or over a source of columns, i.e. an object s with
+ * s.size() and s.template column<"name">() returning a contiguous range (e.g. columnar::reader),
+ * in which case each field reads its column directly.
+ */
+namespace lightray::refl::q
+{
+    namespace detail
+    {
+        template <reflected T, mtp::fixed_string Name>
+        constexpr auto field_member() noexcept -> auto
+        {
+            return meta_cache<T>::template data_member<Name>();
+        }
+
+        // Evaluates both operands, so that a && b compiles to a bitwise and rather than a branch,
+        // unless the right one may trap, see binary_t.
+        struct logical_and
+        {
+            constexpr auto operator()(bool a, bool b) const noexcept -> bool { return a & b; }
+        };
+
+        struct logical_or
+        {
+            constexpr auto operator()(bool a, bool b) const noexcept -> bool { return a | b; }
+        };
+
+        template <typename Source>
+        concept record_range = std::ranges::input_range<const Source> && reflected<std::ranges::range_value_t<const Source>>;
+
+        template <typename Source>
+        concept column_source = !record_range<Source> && requires (const Source& s) { { s.size() } -> std::convertible_to<std::size_t>; };
+
+        template <typename Fn>
+        struct bound
+        {
+            Fn fn;
+
+            constexpr auto operator()(std::size_t i) const -> decltype(auto) { return fn(i); }
+
+        }; // struct bound
+
+        template <typename Fn>
+        bound(Fn) -> bound<Fn>;
+
+        // Whether evaluating the expression E may trap, e.g. on an integer division by zero.
+        template <typename E>
+        constexpr bool may_trap = false;
+
+        // Whether Op, applied to l and r(), must only evaluate r() if l does not decide the result.
+        template <typename Op, typename R>
+        constexpr bool short_circuits =
+            (std::same_as<Op, logical_and> || std::same_as<Op, logical_or>) && may_trap<R>;
+
+        template <typename Op, typename R>
+        constexpr auto short_circuit(bool l, const R& r) -> bool
+        {
+            if constexpr (std::same_as<Op, logical_and>)
+                return l && static_cast<bool>(r());
+            else
+                return l || static_cast<bool>(r());
+        }
+
+    } // namespace detail
+
+    template <typename E>
+    concept expression = requires { typename std::remove_cvref_t<E>::query_expression_tag; };
+
+    /*
+     * The data member named Name of the record.
+     */
+    template <mtp::fixed_string Name>
+    struct field_t
+    {
+        using query_expression_tag = void;
+
+        template <reflected T>
+        constexpr auto eval(const T& record) const -> decltype(auto)
+        {
+            return detail::field_member<T, Name>().invoke(record);
+        }
+
+        template <detail::column_source Source>
+        auto bind(const Source& source) const -> auto
+        {
+            const auto* data = std::ranges::data(source.template column<Name>());
+            return detail::bound{[data](std::size_t i) -> decltype(auto) { return data[i]; }};
+        }
+
+    }; // struct field_t
+
+    template <mtp::fixed_string Name>
+    constexpr field_t<Name> field{};
+
+    template <typename V>
+    struct constant_t
+    {
+        using query_expression_tag = void;
+
+        V value;
+
+        constexpr auto eval(const auto&) const noexcept -> const V& { return value; }
+
+        template <detail::column_source Source>
+        auto bind(const Source&) const -> auto
+        {
+            return detail::bound{[value = value](std::size_t) { return value; }};
+        }
+
+    }; // struct constant_t
+
+    /*
+     * A predicate which accepts every record.
+     */
+    constexpr constant_t<bool> always{true};
+
+    template <typename Op, typename E>
+    struct unary_t
+    {
+        using query_expression_tag = void;
+
+        E operand;
+
+        constexpr auto eval(const auto& record) const -> decltype(auto)
+        {
+            return Op{}(operand.eval(record));
+        }
+
+        template <detail::column_source Source>
+        auto bind(const Source& source) const -> auto
+        {
+            return detail::bound{[e = operand.bind(source)](std::size_t i) { return Op{}(e(i)); }};
+        }
+
+    }; // struct unary_t
+
+    template <typename Op, typename L, typename R>
+    struct binary_t
+    {
+        using query_expression_tag = void;
+
+        L left;
+        R right;
+
+        constexpr auto eval(const auto& record) const -> decltype(auto)
+        {
+            if constexpr (detail::short_circuits<Op, R>)
+                return detail::short_circuit<Op>(left.eval(record), [&] { return right.eval(record); });
+            else
+                return Op{}(left.eval(record), right.eval(record));
+        }
+
+        template <detail::column_source Source>
+        auto bind(const Source& source) const -> auto
+        {
+            return detail::bound{[l = left.bind(source), r = right.bind(source)](std::size_t i) {
+                if constexpr (detail::short_circuits<Op, R>)
+                    return detail::short_circuit<Op>(l(i), [&] { return r(i); });
+                else
+                    return Op{}(l(i), r(i));
+            }};
+        }
+
+    }; // struct binary_t
+
+    namespace detail
+    {
+        template <typename Op, typename E>
+        constexpr bool may_trap<unary_t<Op, E>> = may_trap<E>;
+
+        template <typename Op, typename L, typename R>
+        constexpr bool may_trap<binary_t<Op, L, R>> = std::same_as<Op, std::divides<>> || may_trap<L> || may_trap<R>;
+
+    } // namespace detail
+
+    namespace detail
+    {
+        template <typename E>
+        constexpr auto as_expression(E&& e) -> auto
+        {
+            if constexpr (expression<E>)
+                return std::remove_cvref_t<E>(std::forward<E>(e));
+            else
+                return constant_t<std::decay_t<E>>{std::forward<E>(e)};
+        }
+
+        template <typename L, typename R>
+        concept operands = (expression<L> || expression<R>);
+
+        template <typename Op, typename L, typename R>
+        constexpr auto make_binary(L&& l, R&& r) -> auto
+        {
+            using left_t = decltype(as_expression(std::forward<L>(l)));
+            using right_t = decltype(as_expression(std::forward<R>(r)));
+            return binary_t<Op, left_t, right_t>{as_expression(std::forward<L>(l)), as_expression(std::forward<R>(r))};
+        }
+
+    } // namespace detail
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator==(L&& l, R&& r) { return detail::make_binary<std::equal_to<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator!=(L&& l, R&& r) { return detail::make_binary<std::not_equal_to<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator<(L&& l, R&& r) { return detail::make_binary<std::less<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator<=(L&& l, R&& r) { return detail::make_binary<std::less_equal<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator>(L&& l, R&& r) { return detail::make_binary<std::greater<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator>=(L&& l, R&& r) { return detail::make_binary<std::greater_equal<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator+(L&& l, R&& r) { return detail::make_binary<std::plus<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator-(L&& l, R&& r) { return detail::make_binary<std::minus<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator*(L&& l, R&& r) { return detail::make_binary<std::multiplies<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator/(L&& l, R&& r) { return detail::make_binary<std::divides<>>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator&&(L&& l, R&& r) { return detail::make_binary<detail::logical_and>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <typename L, typename R> requires detail::operands<L, R>
+    constexpr auto operator||(L&& l, R&& r) { return detail::make_binary<detail::logical_or>(std::forward<L>(l), std::forward<R>(r)); }
+
+    template <expression E>
+    constexpr auto operator!(E&& e) { return unary_t<std::logical_not<>, std::remove_cvref_t<E>>{std::forward<E>(e)}; }
+
+    template <expression E>
+    constexpr auto operator-(E&& e) { return unary_t<std::negate<>, std::remove_cvref_t<E>>{std::forward<E>(e)}; }
+
+    /*
+     * The data member of T named at run time, converted to double, for queries built from user
+     * input. Only arithmetic and enumeration data members can be named.
+     * Throws std::invalid_argument if T has no such data member.
+     */
+    template <reflected T>
+    struct named_field_t
+    {
+        using query_expression_tag = void;
+
+        auto (*get)(const T&) -> double;
+
+        auto eval(const T& record) const -> double
+        {
+            return get(record);
+        }
+
+    }; // struct named_field_t
+
+    namespace detail
+    {
+        template <auto Member>
+        constexpr auto field_name = Member.name();
+
+        template <auto Member>
+        constexpr bool numeric_member_v =
+            std::is_arithmetic_v<refl::detail::layout_member_type_t<Member>>
+         || std::is_enum_v<refl::detail::layout_member_type_t<Member>>;
+
+    } // namespace detail
+
+    template <reflected T>
+    auto field_named(std::string_view name) -> named_field_t<T>
+    {
+        named_field_t<T> result{nullptr};
+        type_info_<T>.data_members().for_each([&]<auto Member>{
+            if constexpr (detail::numeric_member_v<Member>)
+                if (std::string_view(detail::field_name<Member>.c_str()) == name)
+                    result.get = +[](const T& record) -> double {
+                        return static_cast<double>(Member.invoke(record));
+                    };
+        });
+
+        if (!result.get)
+            throw std::invalid_argument("refl::q::field_named: no numeric data member named " + std::string(name));
+        return result;
+    }
+
+    /*
+     * Aggregates, which fold the value of an expression over the records a query selects.
+     */
+    template <expression E>
+    struct sum_t
+    {
+        E expr;
+
+        template <typename V>
+        using state_type = std::remove_cvref_t<decltype(std::declval<V>() + std::declval<V>())>;
+
+        template <typename V>
+        static constexpr auto init() noexcept -> state_type<V> { return {}; }
+
+        template <typename S, typename V>
+        static constexpr auto add(S& state, const V& value) noexcept -> void
+        {
+            state += static_cast<S>(value);
+        }
+
+        template <typename S>
+        static constexpr auto result(const S& state) noexcept -> S { return state; }
+
+    }; // struct sum_t
+
+    template <typename Compare, expression E>
+    struct extremum_t
+    {
+        E expr;
+
+        template <typename V>
+        using state_type = std::pair<std::remove_cvref_t<V>, bool>;
+
+        template <typename V>
+        static constexpr auto init() noexcept -> state_type<V> { return {std::remove_cvref_t<V>{}, false}; }
+
+        template <typename S, typename V>
+        static constexpr auto add(S& state, const V& value) noexcept -> void
+        {
+            const bool take = !state.second | Compare{}(value, state.first);
+            state.first = take ? value : state.first;
+            state.second = true;
+        }
+
+        template <typename S>
+        static constexpr auto result(const S& state) -> std::optional<typename S::first_type>
+        {
+            return state.second ? std::optional(state.first) : std::nullopt;
+        }
+
+    }; // struct extremum_t
+
+    struct count_t
+    {
+        constant_t<bool> expr{true};
+
+        template <typename V>
+        using state_type = std::size_t;
+
+        template <typename V>
+        static constexpr auto init() noexcept -> std::size_t { return 0; }
+
+        template <typename V>
+        static constexpr auto add(std::size_t& state, const V&) noexcept -> void { ++state; }
+
+        static constexpr auto result(std::size_t state) noexcept -> std::size_t { return state; }
+
+    }; // struct count_t
+
+    template <typename E>
+    constexpr auto sum(E&& e) { return sum_t<decltype(detail::as_expression(std::forward<E>(e)))>{detail::as_expression(std::forward<E>(e))}; }
+
+    template <typename E>
+    constexpr auto min(E&& e) { return extremum_t<std::less<>, decltype(detail::as_expression(std::forward<E>(e)))>{detail::as_expression(std::forward<E>(e))}; }
+
+    template <typename E>
+    constexpr auto max(E&& e) { return extremum_t<std::greater<>, decltype(detail::as_expression(std::forward<E>(e)))>{detail::as_expression(std::forward<E>(e))}; }
+
+    constexpr auto count() { return count_t{}; }
+
+    namespace detail
+    {
+        template <typename Agg, typename Row>
+        using agg_value_t = decltype(std::declval<const Agg&>().expr.eval(std::declval<const Row&>()));
+
+        template <typename Agg, typename Row>
+        using agg_state_t = typename Agg::template state_type<agg_value_t<Agg, Row>>;
+
+        template <typename... Results>
+        constexpr auto agg_results(Results&&... results) -> auto
+        {
+            if constexpr (sizeof...(Results) == 1)
+                return (std::forward<Results>(results), ...);
+            else
+                return std::tuple{std::forward<Results>(results)...};
+        }
+
+    } // namespace detail
+
+    /*
+     * Folds each of aggs over the records of source which satisfy pred, in a single pass, and
+     * returns the result of the aggregate, or a tuple of results if there are several.
+     * min and max return an empty std::optional when no record satisfies pred.
+     */
+    template <typename Source, expression Pred, typename... Aggs>
+    requires (sizeof...(Aggs) > 0)
+    auto aggregate(const Source& source, const Pred& pred, const Aggs&... aggs) -> auto
+    {
+        if constexpr (detail::record_range<Source>)
+        {
+            using row_t = std::ranges::range_value_t<const Source>;
+
+            std::tuple<detail::agg_state_t<Aggs, row_t>...> states{Aggs::template init<detail::agg_value_t<Aggs, row_t>>()...};
+            for (const auto& record : source)
+            {
+                if (pred.eval(record))
+                    std::apply([&](auto&... state) { (aggs.add(state, aggs.expr.eval(record)), ...); }, states);
+            }
+            return std::apply([&](const auto&... state) { return detail::agg_results(aggs.result(state)...); }, states);
+        }
+        else
+        {
+            const auto keep_at = pred.bind(source);
+            const auto values = std::tuple{aggs.expr.bind(source)...};
+            const auto n = static_cast<std::size_t>(source.size());
+
+            return std::apply([&](const auto&... value_at) {
+                std::tuple states{Aggs::template init<decltype(value_at(std::size_t{}))>()...};
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (keep_at(i))
+                        std::apply([&](auto&... state) { (aggs.add(state, value_at(i)), ...); }, states);
+                }
+                return std::apply([&](const auto&... state) { return detail::agg_results(aggs.result(state)...); }, states);
+            }, values);
+        }
+    }
+
+    /*
+     * The number of records of source which satisfy pred.
+     */
+    template <typename Source, expression Pred>
+    auto count(const Source& source, const Pred& pred) -> std::size_t
+    {
+        return aggregate(source, pred, count());
+    }
+
+    /*
+     * Copies the records of records which satisfy pred.
+     */
+    template <detail::record_range Records, expression Pred>
+    auto filter(const Records& records, const Pred& pred) -> std::vector<std::ranges::range_value_t<const Records>>
+    {
+        std::vector<std::ranges::range_value_t<const Records>> result;
+        for (const auto& record : records)
+            if (pred.eval(record))
+                result.push_back(record);
+        return result;
+    }
+
+    /*
+     * Evaluates exprs on each record of records which satisfies pred, into a tuple per record.
+     */
+    template <detail::record_range Records, expression Pred, expression... Exprs>
+    auto project(const Records& records, const Pred& pred, const Exprs&... exprs) -> auto
+    {
+        using row_t = std::ranges::range_value_t<const Records>;
+        std::vector<std::tuple<std::remove_cvref_t<decltype(exprs.eval(std::declval<const row_t&>()))>...>> result;
+        for (const auto& record : records)
+            if (pred.eval(record))
+                result.emplace_back(exprs.eval(record)...);
+        return result;
+    }
+
+    /*
+     * Groups the records of records which satisfy pred by the value of key, and folds each of
+     * aggs over each group, as aggregate does. Returns a map from each key to its result(s).
+     */
+    template <detail::record_range Records, expression Pred, expression Key, typename... Aggs>
+    requires (sizeof...(Aggs) > 0)
+    auto group_by(const Records& records, const Pred& pred, const Key& key, const Aggs&... aggs) -> auto
+    {
+        using row_t = std::ranges::range_value_t<const Records>;
+        using key_t = std::remove_cvref_t<decltype(key.eval(std::declval<const row_t&>()))>;
+        using states_t = std::tuple<detail::agg_state_t<Aggs, row_t>...>;
+
+        std::unordered_map<key_t, states_t> groups;
+        for (const auto& record : records)
+        {
+            if (!pred.eval(record))
+                continue;
+
+            auto [it, inserted] = groups.try_emplace(
+                key.eval(record), states_t{Aggs::template init<detail::agg_value_t<Aggs, row_t>>()...}
+            );
+            std::apply([&](auto&... state) { (aggs.add(state, aggs.expr.eval(record)), ...); }, it->second);
+        }
+
+        using result_t = decltype(std::apply(
+            [&](const auto&... state) { return detail::agg_results(aggs.result(state)...); }, std::declval<const states_t&>()
+        ));
+        std::unordered_map<key_t, result_t> result;
+        result.reserve(groups.size());
+        for (const auto& [k, states] : groups)
+            result.emplace(k, std::apply([&](const auto&... state) { return detail::agg_results(aggs.result(state)...); }, states));
+        return result;
+    }
+
+} // namespace lightray::refl::q
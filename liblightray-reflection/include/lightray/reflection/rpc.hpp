@@ -0,0 +1,530 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <lightray/metaprogramming/fixed_string.hpp>
+#include <lightray/metaprogramming/string_id.hpp>
+#include <lightray/metaprogramming/inherit_from.hpp>
+#include <lightray/metaprogramming/overload.hpp>
+#include <lightray/metaprogramming/tags.hpp>
+#include <lightray/metaprogramming/type.hpp>
+#include <lightray/metaprogramming/value.hpp>
+#include <lightray/metaprogramming/void_ref_ptr.hpp>
+#include <lightray/metaprogramming/traits/function_traits.hpp>
+#include <lightray/metaprogramming/traits/qualifier_traits.hpp>
+
+#include "dyn.hpp"
+#include "meta_cache.hpp"
+#include "serialize.hpp"
+#include "type_info.hpp"
+
+
+/*
+ * Remote procedure calls generated from the interface_proxy metadata of a prototype, i.e. the same
+ * prototypes dyn<Prototype> dispatches on.
+ *
+ * Each function of each interface_proxy is assigned a method id, in declaration order, so that a
+ * request is dispatched with a single table lookup. A request is the method id (u32) followed by
+ * the arguments encoded with refl::serialize, and a response is a status byte followed by either
+ * the encoded return value, or the message of the exception thrown by the implementation.
+ *
+ * Arguments and return values must be serializable (see serializable_v), and are passed by value:
+ * arguments taken by non-const lvalue reference are not written back to the caller.
+ *
+ * A transport moves requests and responses between a client and a server. It must provide
+ *  - round_trip(request, response): sends request and waits for the response, on the client side,
+ *  - serve(server): dispatches the requests it receives to server, on the server side, and keeps
+ *    serving whatever a single request throws (see detail::serve_one).
+ * queue_transport connects a client and a server in the same process, and unix_socket_transport
+ * (see rpc_unix_socket.hpp) connects them through a Unix domain socket.
+ */
+namespace lightray::refl::rpc
+{
+    /*
+     * Thrown by a client call when the implementation threw, with the message of that exception.
+     */
+    struct remote_error : std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+
+    }; // struct remote_error
+
+    enum class response_status : std::uint8_t
+    {
+        ok,
+        error,
+    };
+
+    using method_id = std::uint32_t;
+
+    namespace detail
+    {
+        template <auto Member>
+        using interface_t = mtp::splice::type::decl_t<Member.template interface_proxy_type<void>()>;
+
+        template <auto Member>
+        constexpr auto function_count() noexcept -> std::size_t
+        {
+            if constexpr (std::same_as<decltype(Member.template interface_proxy_type<void>()), mtp::none_t>)
+                return 0;
+            else
+                return interface_t<Member>::function_count();
+        }
+
+        template <auto Member, std::size_t I>
+        using function_signature_t = mtp::splice::type::decl_t<interface_t<Member>::template function_type<I>()>;
+
+        template <reflected Prototype>
+        constexpr auto function_counts = type_info_<Prototype>.members().apply([]<auto... Members>{
+            return std::array<std::size_t, sizeof...(Members)>{function_count<Members>()...};
+        });
+
+        template <reflected Prototype>
+        constexpr std::size_t method_count = [] {
+            std::size_t count = 0;
+            for (auto n : function_counts<Prototype>)
+                count += n;
+            return count;
+        } ();
+
+        // Functions are numbered in declaration order of their member, then of their signature.
+        template <reflected Prototype, auto Member, std::size_t I>
+        constexpr method_id method_id_of = [] {
+            std::size_t id = I;
+            for (std::size_t m = 0; m < Member.index(); ++m)
+                id += function_counts<Prototype>[m];
+            return static_cast<method_id>(id);
+        } ();
+
+        template <typename T>
+        constexpr bool passable_v = serializable_v<std::remove_cvref_t<T>>;
+
+        // Arguments may be views, which view the request for the duration of the call, but results
+        // may not, as the response they would view is gone when the call returns.
+        template <typename Signature>
+        constexpr bool callable_v = [] {
+            using func_traits = mtp::traits::function_traits<Signature>;
+            using return_t = typename func_traits::return_type;
+
+            return (
+                std::is_void_v<return_t>
+             || (!std::is_reference_v<return_t> && passable_v<return_t> && !refl::detail::serialize_borrows_v<return_t>)
+            )
+                && mtp::make_index_sequence<func_traits::argument_count>.apply([]<std::size_t... Is>{
+                    return (true && ... && passable_v<typename func_traits::template argument_type<Is>>);
+                });
+        } ();
+
+        // Buffers are recycled per thread, so that steady state calls do not allocate.
+        inline auto buffer_cache() noexcept -> std::vector<std::vector<std::byte>>&
+        {
+            static thread_local std::vector<std::vector<std::byte>> cache;
+            return cache;
+        }
+
+        struct buffer
+        {
+            std::vector<std::byte> bytes;
+
+            buffer()
+            {
+                if (auto& cache = buffer_cache(); !cache.empty())
+                {
+                    bytes = std::move(cache.back());
+                    cache.pop_back();
+                }
+            }
+
+            buffer(const buffer&) = delete;
+            auto operator=(const buffer&) -> buffer& = delete;
+
+            ~buffer()
+            {
+                bytes.clear();
+                buffer_cache().push_back(std::move(bytes));
+            }
+
+        }; // struct buffer
+
+        // The id accessor through which a client's interface_proxy functions reach the transport.
+        template <method_id Id, typename Signature>
+        struct call_accessor
+        {
+            template <typename Client, typename... Args>
+            static auto invoke(Client&& client, Args&&... args)
+            -> typename mtp::traits::function_traits<Signature>::return_type
+            {
+                static_assert(callable_v<Signature>, "refl::rpc: arguments and return value must be serializable, and the return value must not be a view");
+
+                using return_t = typename mtp::traits::function_traits<Signature>::return_type;
+                return client.template call<Id, return_t>(std::forward<Args>(args)...);
+            }
+
+        }; // struct call_accessor
+
+        /*
+         * Client overloads are keyed by the interned names of the members, so that the symbol of
+         * each of them does not spell out the name.
+         */
+        template <reflected Prototype, mtp::string_id Id>
+        constexpr auto member_with_id() noexcept -> auto
+        {
+            static_assert(
+                mtp::all_distinct(meta_cache<Prototype>::member_ids),
+                "refl::rpc: the interned names of the members of Prototype collide, please rename one of them"
+            );
+            return meta_cache<Prototype>::members.template get<meta_cache<Prototype>::index_of(Id)>();
+        }
+
+        template <reflected Prototype, typename Client, mtp::string_id Id>
+        constexpr auto make_client_overload() noexcept -> auto
+        {
+            constexpr auto member = member_with_id<Prototype, Id>();
+
+            return mtp::make_index_sequence<function_count<member>()>.apply([]<std::size_t... Is>{
+                constexpr auto func_ptr_tuple = std::tuple_cat(
+                    refl::detail::dyn_make_function_pointers<
+                        Client,
+                        call_accessor<
+                            method_id_of<Prototype, member_with_id<Prototype, Id>(), Is>,
+                            function_signature_t<member_with_id<Prototype, Id>(), Is>
+                        >,
+                        function_signature_t<member_with_id<Prototype, Id>(), Is>
+                    >()...
+                );
+                constexpr auto func_ptr_count = std::tuple_size_v<std::remove_const_t<decltype(func_ptr_tuple)>>;
+                return mtp::make_index_sequence<func_ptr_count>.apply([func_ptr_tuple=func_ptr_tuple]<auto... FnIs>{
+                    return mtp::overload{std::get<FnIs>(func_ptr_tuple)...};
+                });
+            });
+        }
+
+        template <reflected Prototype, typename Client, mtp::string_id Id>
+        constexpr auto client_overload = make_client_overload<Prototype, Client, Id>();
+
+        template <reflected Prototype, typename Derived>
+        constexpr auto client_base_type() noexcept -> auto
+        {
+            return type_info_<Prototype>.members()
+                .filter([]<auto Member>{ return mtp::value<function_count<Member>() != 0>; })
+                .apply([]<auto... Members>{
+                    using mtp::splice::type::decl_t;
+                    return mtp::type<mtp::inherit_from<decl_t<Members.template interface_proxy_type<Derived>()>...>>;
+                });
+        }
+
+        template <typename Target, auto Member, std::size_t I>
+        auto dispatch_method(Target& target, std::span<const std::byte> request, std::vector<std::byte>& response)
+        -> void
+        {
+            static_assert(callable_v<function_signature_t<Member, I>>, "refl::rpc: arguments and return value must be serializable, and the return value must not be a view");
+
+            using func_traits = mtp::traits::function_traits<function_signature_t<Member, I>>;
+            using qual_traits = typename func_traits::qualifier_traits;
+            using return_t = typename func_traits::return_type;
+            using id_accessor_t = mtp::splice::type::decl_t<Member.id_accessor_type()>;
+            using self_t = std::conditional_t<
+                qual_traits::is_reference,
+                typename qual_traits::template apply<Target>,
+                typename qual_traits::template apply<Target>&
+            >;
+
+            mtp::make_index_sequence<func_traits::argument_count>.apply([&]<std::size_t... Is>{
+                std::tuple<std::remove_cvref_t<typename func_traits::template argument_type<Is>>...> args;
+                (deserialize(request, std::get<Is>(args)), ...);
+                if (!request.empty())
+                    throw deserialize_error("refl::rpc::server: trailing bytes after arguments");
+
+                const auto invoke = [&] -> decltype(auto) {
+                    return id_accessor_t::invoke(
+                        static_cast<self_t>(target),
+                        static_cast<typename func_traits::template argument_type<Is>&&>(std::get<Is>(args))...
+                    );
+                };
+
+                serialize(response, response_status::ok);
+                if constexpr (std::is_void_v<return_t>)
+                    invoke();
+                else
+                    serialize(response, invoke());
+            });
+        }
+
+        inline auto write_error_response(std::vector<std::byte>& response, std::string message) -> void
+        {
+            response.clear();
+            serialize(response, response_status::error);
+            serialize(response, message);
+        }
+
+        /*
+         * Dispatches request to server, and reports any exception escaping it in the response,
+         * so that no request can end the serve loop of a transport. If not even that can be done,
+         * e.g. for lack of memory, the response is left empty, which the client fails to decode.
+         */
+        template <typename Server>
+        auto serve_one(const Server& server, std::span<const std::byte> request, std::vector<std::byte>& response) noexcept
+        -> void
+        {
+            try
+            {
+                try
+                {
+                    server.dispatch(request, response);
+                }
+                catch (const std::exception& e)
+                {
+                    write_error_response(response, e.what());
+                }
+                catch (...)
+                {
+                    write_error_response(response, "refl::rpc: unknown exception");
+                }
+            }
+            catch (...)
+            {
+                response.clear();
+            }
+        }
+
+        template <reflected Prototype, typename Target>
+        constexpr auto make_dispatch_table() noexcept -> auto
+        {
+            using dispatch_fn = void (*)(Target&, std::span<const std::byte>, std::vector<std::byte>&);
+
+            std::array<dispatch_fn, method_count<Prototype>> table{};
+            type_info_<Prototype>.members().for_each([&]<auto Member>{
+                mtp::make_index_sequence<function_count<Member>()>.for_each([&]<std::size_t I>{
+                    table[method_id_of<Prototype, Member, I>] = &dispatch_method<Target, Member, I>;
+                });
+            });
+            return table;
+        }
+
+    } // namespace detail
+
+    /*
+     * Number of methods of Prototype, i.e. of signatures across all of its interface_proxy members.
+     */
+    template <reflected Prototype>
+    constexpr std::size_t method_count = detail::method_count<Prototype>;
+
+    /*
+     * Dispatches requests to the implementation of Prototype referred to by target, by calling
+     * the member functions of Target named after the members of Prototype.
+     */
+    template <reflected Prototype, typename Target = dyn<Prototype>>
+    class server
+    {
+    private:
+        static constexpr auto dispatch_table = detail::make_dispatch_table<Prototype, Target>();
+
+        Target* _target;
+
+    public:
+        explicit server(Target& target) noexcept : _target(std::addressof(target)) {}
+
+        /*
+         * Decodes request, calls the method it names and writes the response to response.
+         * Exceptions of any type thrown by the implementation, or by decoding a malformed request,
+         * are reported in the response.
+         */
+        auto dispatch(std::span<const std::byte> request, std::vector<std::byte>& response) const -> void
+        {
+            response.clear();
+            try
+            {
+                method_id id;
+                deserialize(request, id);
+                if (id >= dispatch_table.size())
+                    throw deserialize_error("refl::rpc::server: unknown method");
+
+                dispatch_table[id](*_target, request, response);
+            }
+            catch (const std::exception& e)
+            {
+                detail::write_error_response(response, e.what());
+            }
+            catch (...)
+            {
+                detail::write_error_response(response, "refl::rpc::server: unknown exception");
+            }
+        }
+
+    }; // class server
+
+    template <reflected Prototype, typename Target>
+    auto make_server(Target& target) noexcept -> server<Prototype, Target>
+    {
+        return server<Prototype, Target>(target);
+    }
+
+    /*
+     * Exposes the interface_proxy functions of Prototype, and forwards calls to them to a remote
+     * server through transport. Being a class with those member functions, a client can itself be
+     * the implementation behind a dyn<Prototype>.
+     *
+     * Calls are synchronous: each call returns once the transport delivered its response, and
+     * throws remote_error if the implementation threw. A client may be shared between threads
+     * if its transport's round_trip may be, as is the case for the transports of this library.
+     */
+    template <reflected Prototype, typename Transport>
+    class client : public mtp::splice::type::decl_t<detail::client_base_type<Prototype, client<Prototype, Transport>>()>
+    {
+    private:
+        Transport* _transport;
+
+    public:
+        explicit client(Transport& transport) noexcept : _transport(std::addressof(transport)) {}
+
+        template <method_id Id, typename Return, typename... Args>
+        auto call(Args&&... args) const -> Return
+        {
+            static_assert(Id < method_count<Prototype>);
+
+            detail::buffer request;
+            detail::buffer response;
+
+            serialize(request.bytes, Id);
+            (serialize(request.bytes, args), ...);
+            _transport->round_trip(std::span<const std::byte>(request.bytes), response.bytes);
+
+            std::span<const std::byte> in = response.bytes;
+            response_status status;
+            deserialize(in, status);
+
+            if (status != response_status::ok)
+            {
+                std::string message;
+                deserialize(in, message);
+                throw remote_error(message);
+            }
+
+            if constexpr (!std::is_void_v<Return>)
+            {
+                Return result;
+                deserialize(in, result);
+                return result;
+            }
+        }
+
+        constexpr auto on_proxy_invoked(auto info, auto&&... args) & -> decltype(auto)
+        {
+            return detail::client_overload<Prototype, client, mtp::intern(info.name())>(
+                mtp::void_ref_ptr<mtp::traits::lvalue_traits>{this},
+                std::forward<decltype(args)>(args)...
+            );
+        }
+
+        constexpr auto on_proxy_invoked(auto info, auto&&... args) const & -> decltype(auto)
+        {
+            return detail::client_overload<Prototype, client, mtp::intern(info.name())>(
+                mtp::void_ref_ptr<mtp::traits::const_lvalue_traits>{this},
+                std::forward<decltype(args)>(args)...
+            );
+        }
+
+        constexpr auto on_proxy_invoked(auto info, auto&&... args) && -> decltype(auto)
+        {
+            return detail::client_overload<Prototype, client, mtp::intern(info.name())>(
+                mtp::void_ref_ptr<mtp::traits::rvalue_traits>{this},
+                std::forward<decltype(args)>(args)...
+            );
+        }
+
+        constexpr auto on_proxy_invoked(auto info, auto&&... args) const && -> decltype(auto)
+        {
+            return detail::client_overload<Prototype, client, mtp::intern(info.name())>(
+                mtp::void_ref_ptr<mtp::traits::const_rvalue_traits>{this},
+                std::forward<decltype(args)>(args)...
+            );
+        }
+
+    }; // class client
+
+    /*
+     * Connects clients and a server in the same process through a request queue.
+     *
+     * round_trip blocks until a thread running serve has dispatched the request, which is read
+     * in place, without being copied. serve dispatches requests until close is called.
+     */
+    class queue_transport
+    {
+    private:
+        struct pending
+        {
+            std::span<const std::byte> request;
+            std::vector<std::byte>* response;
+            bool done;
+
+        }; // struct pending
+
+        std::mutex _mutex;
+        std::condition_variable _requested;
+        std::condition_variable _responded;
+        std::deque<pending*> _queue;
+        bool _closed = false;
+
+    public:
+        auto round_trip(std::span<const std::byte> request, std::vector<std::byte>& response) -> void
+        {
+            pending p{request, &response, false};
+
+            std::unique_lock lock(_mutex);
+            if (_closed)
+                throw std::runtime_error("refl::rpc::queue_transport: closed");
+
+            _queue.push_back(&p);
+            _requested.notify_one();
+            _responded.wait(lock, [&] { return p.done; });
+        }
+
+        template <typename Server>
+        auto serve(const Server& server) -> void
+        {
+            std::unique_lock lock(_mutex);
+            while (true)
+            {
+                _requested.wait(lock, [&] { return _closed || !_queue.empty(); });
+                if (_queue.empty())
+                    return;
+
+                auto* p = _queue.front();
+                _queue.pop_front();
+
+                lock.unlock();
+                detail::serve_one(server, p->request, *p->response);
+                lock.lock();
+
+                p->done = true;
+                _responded.notify_all();
+            }
+        }
+
+        /*
+         * Makes serve return once the requests already queued have been dispatched.
+         */
+        auto close() -> void
+        {
+            std::lock_guard lock(_mutex);
+            _closed = true;
+            _requested.notify_all();
+        }
+
+    }; // class queue_transport
+
+} // namespace lightray::refl::rpc
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "rpc.hpp"
+
+
+namespace lightray::refl::rpc
+{
+    namespace detail
+    {
+        [[noreturn]] inline auto socket_fail(const char* what) -> void
+        {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        inline auto socket_address(const std::filesystem::path& path) -> sockaddr_un
+        {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            if (path.native().size() >= sizeof(address.sun_path))
+                throw std::invalid_argument("refl::rpc: socket path too long: " + path.string());
+            std::memcpy(address.sun_path, path.c_str(), path.native().size());
+            return address;
+        }
+
+        inline auto socket_write(int fd, const void* data, std::size_t size) -> void
+        {
+            for (auto* p = static_cast<const std::byte*>(data); size != 0;)
+            {
+                const auto n = ::send(fd, p, size, MSG_NOSIGNAL);
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n < 0)
+                    socket_fail("refl::rpc::unix_socket_transport: send");
+
+                p += n;
+                size -= static_cast<std::size_t>(n);
+            }
+        }
+
+        // Returns false if the peer closed the connection before the first byte.
+        inline auto socket_read(int fd, void* data, std::size_t size) -> bool
+        {
+            for (auto* p = static_cast<std::byte*>(data), * first = p; size != 0;)
+            {
+                const auto n = ::recv(fd, p, size, 0);
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n < 0)
+                    socket_fail("refl::rpc::unix_socket_transport: recv");
+                if (n == 0)
+                {
+                    if (p == first)
+                        return false;
+                    throw deserialize_error("refl::rpc::unix_socket_transport: connection closed mid-frame");
+                }
+
+                p += n;
+                size -= static_cast<std::size_t>(n);
+            }
+            return true;
+        }
+
+    } // namespace detail
+
+    /*
+     * A connected Unix domain stream socket, which carries each request and response as a frame
+     * of its size (u64) followed by its bytes.
+     *
+     * A client side transport is obtained from connect, and a server side one from
+     * unix_socket_listener::accept. Throws std::system_error on socket errors.
+     *
+     * round_trip may be called from several threads at once, e.g. through a shared client, and
+     * the calls are serialized: one request is in flight at a time. serve dispatches requests
+     * until the client disconnects. Exceptions thrown by the implementation are sent back
+     * as error responses and never end it.
+     *
+     * Frames larger than max_frame_size() are rejected with deserialize_error before anything
+     * is allocated for them, after which the connection is unusable. serve first answers the
+     * oversized request with an error response, which round_trip reports even if sending the
+     * rest of the request failed.
+     */
+    class unix_socket_transport
+    {
+    public:
+        static constexpr std::size_t default_max_frame_size = std::size_t{64} << 20;
+
+    private:
+        int _fd = -1;
+        std::size_t _max_frame_size = default_max_frame_size;
+        std::mutex _mutex;
+
+        auto write_frame(std::span<const std::byte> frame) -> void
+        {
+            const auto size = static_cast<std::uint64_t>(frame.size());
+            detail::socket_write(_fd, &size, sizeof(size));
+            detail::socket_write(_fd, frame.data(), frame.size());
+        }
+
+        auto read_frame(std::vector<std::byte>& frame) -> bool
+        {
+            std::uint64_t size;
+            if (!detail::socket_read(_fd, &size, sizeof(size)))
+                return false;
+
+            if (size > _max_frame_size)
+                throw deserialize_error(
+                    "refl::rpc::unix_socket_transport: frame of " + std::to_string(size)
+                  + " bytes exceeds the maximum of " + std::to_string(_max_frame_size)
+                );
+
+            frame.resize(static_cast<std::size_t>(size));
+            if (size != 0 && !detail::socket_read(_fd, frame.data(), frame.size()))
+                throw deserialize_error("refl::rpc::unix_socket_transport: connection closed mid-frame");
+            return true;
+        }
+
+    public:
+        explicit unix_socket_transport(int fd, std::size_t max_frame_size = default_max_frame_size) noexcept
+        :   _fd(fd), _max_frame_size(max_frame_size)
+        {}
+
+        // Must not be in use by another thread.
+        unix_socket_transport(unix_socket_transport&& other) noexcept
+        :   _fd(std::exchange(other._fd, -1)), _max_frame_size(other._max_frame_size)
+        {}
+
+        auto operator=(unix_socket_transport&& other) noexcept -> unix_socket_transport&
+        {
+            if (this != &other)
+            {
+                if (_fd >= 0)
+                    ::close(_fd);
+                _fd = std::exchange(other._fd, -1);
+                _max_frame_size = other._max_frame_size;
+            }
+            return *this;
+        }
+
+        ~unix_socket_transport()
+        {
+            if (_fd >= 0)
+                ::close(_fd);
+        }
+
+        static auto connect(const std::filesystem::path& path, std::size_t max_frame_size = default_max_frame_size)
+        -> unix_socket_transport
+        {
+            const auto address = detail::socket_address(path);
+
+            unix_socket_transport result(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0), max_frame_size);
+            if (result._fd < 0)
+                detail::socket_fail("refl::rpc::unix_socket_transport: socket");
+            if (::connect(result._fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+                detail::socket_fail("refl::rpc::unix_socket_transport: connect");
+            return result;
+        }
+
+        auto max_frame_size() const noexcept -> std::size_t
+        {
+            return _max_frame_size;
+        }
+
+        auto set_max_frame_size(std::size_t max_frame_size) noexcept -> void
+        {
+            _max_frame_size = max_frame_size;
+        }
+
+        auto round_trip(std::span<const std::byte> request, std::vector<std::byte>& response) -> void
+        {
+            std::lock_guard lock(_mutex);
+
+            // serve may reject a request from its size alone, and answer and close before the rest
+            // is sent, which fails the send. Its answer is then still read and reported.
+            std::exception_ptr send_error;
+            try
+            {
+                write_frame(request);
+            }
+            catch (const std::system_error&)
+            {
+                send_error = std::current_exception();
+            }
+
+            try
+            {
+                if (!read_frame(response))
+                {
+                    if (send_error)
+                        std::rethrow_exception(send_error);
+                    throw deserialize_error("refl::rpc::unix_socket_transport: connection closed");
+                }
+            }
+            catch (const deserialize_error&)
+            {
+                // The rest of the frame is still unread, so later responses could not be found.
+                ::shutdown(_fd, SHUT_RDWR);
+                throw;
+            }
+            catch (const std::system_error&)
+            {
+                if (send_error)
+                    std::rethrow_exception(send_error);
+                throw;
+            }
+
+            if (send_error)
+                ::shutdown(_fd, SHUT_RDWR);
+        }
+
+        template <typename Server>
+        auto serve(const Server& server) -> void
+        {
+            std::vector<std::byte> request;
+            std::vector<std::byte> response;
+            while (true)
+            {
+                try
+                {
+                    if (!read_frame(request))
+                        return;
+                }
+                catch (const deserialize_error& e)
+                {
+                    try
+                    {
+                        detail::write_error_response(response, e.what());
+                        write_frame(response);
+                    }
+                    catch (...) {}
+                    throw;
+                }
+
+                detail::serve_one(server, request, response);
+                write_frame(response);
+            }
+        }
+
+    }; // class unix_socket_transport
+
+    /*
+     * A Unix domain socket listening at path, which is removed when the listener is destroyed.
+     */
+    class unix_socket_listener
+    {
+    private:
+        int _fd = -1;
+        std::filesystem::path _path;
+
+    public:
+        explicit unix_socket_listener(std::filesystem::path path) : _path(std::move(path))
+        {
+            const auto address = detail::socket_address(_path);
+
+            _fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (_fd < 0)
+                detail::socket_fail("refl::rpc::unix_socket_listener: socket");
+
+            ::unlink(_path.c_str());
+            if (
+                ::bind(_fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0
+             || ::listen(_fd, SOMAXCONN) != 0
+            )
+            {
+                const auto error = errno;
+                ::close(_fd);
+                throw std::system_error(error, std::generic_category(), "refl::rpc::unix_socket_listener: cannot listen at " + _path.string());
+            }
+        }
+
+        unix_socket_listener(const unix_socket_listener&) = delete;
+        auto operator=(const unix_socket_listener&) -> unix_socket_listener& = delete;
+
+        ~unix_socket_listener()
+        {
+            ::close(_fd);
+            ::unlink(_path.c_str());
+        }
+
+        auto accept(std::size_t max_frame_size = unix_socket_transport::default_max_frame_size) -> unix_socket_transport
+        {
+            int fd;
+            while ((fd = ::accept4(_fd, nullptr, nullptr, SOCK_CLOEXEC)) < 0)
+                if (errno != EINTR)
+                    detail::socket_fail("refl::rpc::unix_socket_listener: accept");
+            return unix_socket_transport(fd, max_frame_size);
+        }
+
+    }; // class unix_socket_listener
+
+} // namespace lightray::refl::rpc
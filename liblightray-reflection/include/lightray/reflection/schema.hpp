@@ -0,0 +1,298 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <lightray/metaprogramming/fixed_string.hpp>
+#include <lightray/metaprogramming/hash.hpp>
+
+#include "layout.hpp"
+#include "meta_category.hpp"
+#include "meta_extraction.hpp"
+#include "serialize.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    namespace detail
+    {
+        // Tags distinguishing the kinds of types in a schema, so that e.g. int32 and float differ.
+        enum class schema_kind : std::uint64_t
+        {
+            reflected = 1,
+            boolean,
+            character,
+            signed_integer,
+            unsigned_integer,
+            floating_point,
+            enumeration,
+            array,
+            range,
+            trivial,
+            opaque,
+            member,
+        };
+
+        template <typename T, typename... Visiting>
+        constexpr auto schema_type_hash() noexcept -> std::uint64_t;
+
+        template <reflected T, typename... Visiting>
+        constexpr auto schema_reflected_hash() noexcept -> std::uint64_t
+        {
+            std::uint64_t hash = static_cast<std::uint64_t>(schema_kind::reflected);
+
+            // Names are mixed in by their FNV-1a hashes, so that adjacent strings do not run together.
+            if constexpr (requires { type_info_<T>.namespace_name().hash(); })
+                hash = mtp::mix_hash(hash, type_info_<T>.namespace_name().hash());
+            hash = mtp::mix_hash(hash, type_info_<T>.name().hash());
+
+            // A type nested in itself, e.g. through std::vector<T>, is identified by name only.
+            if constexpr ((... || std::is_same_v<T, Visiting>))
+                return hash;
+
+            else
+            {
+                if constexpr (std::is_trivially_copyable_v<T>)
+                {
+                    hash = mtp::mix_hash(hash, sizeof(T));
+                    hash = mtp::mix_hash(hash, alignof(T));
+                }
+
+                type_info_<T>.members().for_each([&]<auto Member>{
+                    hash = mtp::mix_hash(hash, static_cast<std::uint64_t>(schema_kind::member));
+                    hash = mtp::mix_hash(hash, Member.name().hash());
+                    hash = mtp::mix_hash(hash, static_cast<std::uint64_t>(Member.category()));
+
+                    if constexpr (Member.category() == meta_category::variable)
+                        hash = mtp::mix_hash(hash, schema_type_hash<layout_member_type_t<Member>, T, Visiting...>());
+                });
+                return hash;
+            }
+        }
+
+        template <typename T, typename... Visiting>
+        constexpr auto schema_type_hash() noexcept -> std::uint64_t
+        {
+            using U = std::remove_cv_t<T>;
+
+            const auto kind = [](schema_kind k, std::uint64_t size) {
+                return mtp::mix_hash(static_cast<std::uint64_t>(k), size);
+            };
+
+            if constexpr (reflected<U>)
+                return schema_reflected_hash<U, Visiting...>();
+
+            else if constexpr (std::is_same_v<U, bool>)
+                return kind(schema_kind::boolean, sizeof(U));
+
+            else if constexpr (
+                std::is_same_v<U, char> || std::is_same_v<U, wchar_t>
+             || std::is_same_v<U, char8_t> || std::is_same_v<U, char16_t> || std::is_same_v<U, char32_t>
+            )
+                return kind(schema_kind::character, sizeof(U));
+
+            else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+                return kind(schema_kind::signed_integer, sizeof(U));
+
+            else if constexpr (std::is_integral_v<U>)
+                return kind(schema_kind::unsigned_integer, sizeof(U));
+
+            else if constexpr (std::is_floating_point_v<U>)
+                return kind(schema_kind::floating_point, sizeof(U));
+
+            else if constexpr (std::is_enum_v<U>)
+                return mtp::mix_hash(kind(schema_kind::enumeration, sizeof(U)), schema_type_hash<std::underlying_type_t<U>>());
+
+            else if constexpr (std::is_bounded_array_v<U>)
+                return mtp::mix_hash(
+                    kind(schema_kind::array, std::extent_v<U>),
+                    schema_type_hash<std::remove_extent_t<U>, Visiting...>()
+                );
+
+            else if constexpr (std::ranges::range<const U>)
+                return mtp::mix_hash(
+                    static_cast<std::uint64_t>(schema_kind::range),
+                    schema_type_hash<std::ranges::range_value_t<const U>, Visiting...>()
+                );
+
+            else if constexpr (std::is_trivially_copyable_v<U>)
+                return mtp::mix_hash(kind(schema_kind::trivial, sizeof(U)), alignof(U));
+
+            else
+                return static_cast<std::uint64_t>(schema_kind::opaque);
+        }
+
+    } // namespace detail
+
+    /*
+     * A fingerprint of the schema of T, usable at compile time.
+     *
+     * It covers the namespace and name of T and, in declaration order, the name and category of
+     * each of its members and the type of each variable member, recursing into reflected types.
+     * Non-reflected types are described by their kind (integer, floating point, range of ...)
+     * and size, and trivially copyable reflected types by their size and alignment, so that
+     * any change which affects the binary representation of T changes its hash.
+     */
+    template <reflected T>
+    constexpr auto schema_hash() noexcept -> std::uint64_t
+    {
+        return detail::schema_type_hash<T>();
+    }
+
+    namespace detail
+    {
+        template <auto Member>
+        constexpr auto schema_member_name = Member.name();
+
+        template <auto Member>
+        constexpr auto schema_member_name_view() noexcept -> std::string_view
+        {
+            return std::string_view{schema_member_name<Member>.c_str()};
+        }
+
+        inline auto schema_take(std::span<const std::byte>& in, std::size_t size) -> std::span<const std::byte>
+        {
+            if (in.size() < size)
+                throw deserialize_error("refl::deserialize_versioned: unexpected end of input");
+
+            const auto result = in.first(size);
+            in = in.subspan(size);
+            return result;
+        }
+
+    } // namespace detail
+
+    /*
+     * Appends value to out, preceded by schema_hash<T>() and a table of its data members,
+     * so that it can be read back by deserialize_versioned after T has changed.
+     *
+     * The encoding is:
+     *  - the schema hash (u64) and the number of data members (u64),
+     *  - for each data member, its name length (u64), its name, the schema hash of its type (u64)
+     *    and its encoded size (u64),
+     *  - the data members encoded with refl::serialize, in declaration order.
+     */
+    template <reflected T>
+    requires serializable_v<T>
+    auto serialize_versioned(std::vector<std::byte>& out, const T& value) -> void
+    {
+        constexpr auto members = type_info_<T>.data_members();
+
+        serialize(out, schema_hash<T>());
+        serialize(out, static_cast<std::uint64_t>(members.size()));
+
+        // Sizes are patched in once the members are encoded.
+        std::array<std::size_t, members.size()> size_positions{};
+        members.apply([&]<auto... Members>{
+            std::size_t i = 0;
+            ([&] {
+                const auto name = detail::schema_member_name_view<Members>();
+                serialize(out, static_cast<std::uint64_t>(name.size()));
+                detail::serialize_append(out, name.data(), name.size());
+                serialize(out, detail::schema_type_hash<detail::layout_member_type_t<Members>>());
+                size_positions[i++] = out.size();
+                serialize(out, std::uint64_t{0});
+            } (), ...);
+        });
+
+        std::size_t i = 0;
+        members.for_each([&]<auto Member>{
+            const auto begin = out.size();
+            serialize(out, Member.invoke(value));
+            const auto size = static_cast<std::uint64_t>(out.size() - begin);
+            std::memcpy(out.data() + size_positions[i++], &size, sizeof(size));
+        });
+    }
+
+    /*
+     * Reads a value written by serialize_versioned from the front of in into value,
+     * and advances in past it. Throws deserialize_error if in is malformed.
+     *
+     * If the schema hash in the stream is schema_hash<T>(), the data members are read in a single
+     * pass with refl::deserialize, which is one block copy when T is bytewise (see is_bytewise_v).
+     * Otherwise each data member in the stream is matched to the data member of T with the same name
+     * and type: members of T missing from the stream keep their value, and members of the stream
+     * missing from T, or whose type has changed, are skipped.
+     *
+     * Returns true if the schema matched.
+     */
+    template <reflected T>
+    requires serializable_v<T>
+    auto deserialize_versioned(std::span<const std::byte>& in, T& value) -> bool
+    {
+        std::uint64_t hash;
+        std::uint64_t count;
+        deserialize(in, hash);
+        deserialize(in, count);
+
+        struct field
+        {
+            std::string_view name;
+            std::uint64_t type_hash;
+            std::uint64_t size;
+        };
+
+        std::vector<field> fields;
+        fields.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(count, in.size())));
+
+        std::uint64_t total_size = 0;
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            std::uint64_t name_size;
+            deserialize(in, name_size);
+            const auto name = detail::schema_take(in, static_cast<std::size_t>(std::min<std::uint64_t>(name_size, in.size() + 1)));
+
+            std::uint64_t type_hash;
+            std::uint64_t size;
+            deserialize(in, type_hash);
+            deserialize(in, size);
+            fields.push_back({{reinterpret_cast<const char*>(name.data()), name.size()}, type_hash, size});
+            total_size += size;
+        }
+
+        auto data = detail::schema_take(in, static_cast<std::size_t>(std::min<std::uint64_t>(total_size, in.size() + 1)));
+
+        if (hash == schema_hash<T>())
+        {
+            if constexpr (detail::serialize_raw<T>)
+                deserialize(data, value);
+            else
+                type_info_<T>.data_members().for_each([&]<auto Member>{
+                    deserialize(data, Member.invoke(value));
+                });
+
+            if (!data.empty())
+                throw deserialize_error("refl::deserialize_versioned: member sizes do not match the schema");
+            return true;
+        }
+
+        for (const auto& f : fields)
+        {
+            auto payload = detail::schema_take(data, static_cast<std::size_t>(f.size));
+
+            type_info_<T>.data_members().for_each([&]<auto Member>{
+                if (
+                    detail::schema_member_name_view<Member>() != f.name
+                 || detail::schema_type_hash<detail::layout_member_type_t<Member>>() != f.type_hash
+                )
+                    return;
+
+                auto remaining = payload;
+                deserialize(remaining, Member.invoke(value));
+                if (!remaining.empty())
+                    throw deserialize_error("refl::deserialize_versioned: member size does not match its type");
+            });
+        }
+        return false;
+    }
+
+} // namespace lightray::refl
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "layout.hpp"
+#include "meta_extraction.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    /*
+     * Thrown when deserializing from an input which is truncated or otherwise malformed.
+     */
+    struct deserialize_error : std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+
+    }; // struct deserialize_error
+
+    namespace detail
+    {
+        template <typename T>
+        constexpr bool serialize_is_std_array = false;
+
+        template <typename T, std::size_t N>
+        constexpr bool serialize_is_std_array<std::array<T, N>> = true;
+
+        // Only values are written as is: a view or any other type holding pointers is not, as the
+        // addresses would mean nothing to the reader, even if it is trivially copyable.
+        template <typename T>
+        constexpr bool serialize_raw_v = []
+        {
+            if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+                return true;
+
+            else if constexpr (std::is_array_v<T>)
+                return serialize_raw_v<std::remove_extent_t<T>>;
+
+            else if constexpr (serialize_is_std_array<std::remove_cv_t<T>>)
+                return serialize_raw_v<typename T::value_type>;
+
+            else if constexpr (reflected<T>)
+            {
+                if constexpr (!is_bytewise_v<T>)
+                    return false;
+                else
+                    return type_info_<T>.data_members().apply([]<auto... Members>{
+                        return (... && serialize_raw_v<layout_member_type_t<Members>>);
+                    });
+            }
+            else
+                return false;
+        } ();
+
+        // Types whose object representation is written as is.
+        template <typename T>
+        concept serialize_raw = serialize_raw_v<T>;
+
+        // The types through which any object may be accessed, and thus the bytes of the input.
+        template <typename T>
+        concept serialize_byte =
+            std::same_as<std::remove_cv_t<T>, char>
+         || std::same_as<std::remove_cv_t<T>, unsigned char>
+         || std::same_as<std::remove_cv_t<T>, std::byte>;
+
+        /*
+         * Views of bytes (e.g. std::string_view or std::span<const std::byte>), which are written as
+         * the bytes they view, and read back as a view into the input rather than into a copy.
+         * Views of anything else cannot be read back, as the input is not aligned for them.
+         */
+        template <typename T>
+        concept serialize_borrowed_view =
+            std::ranges::view<T>
+         && std::ranges::contiguous_range<T>
+         && std::ranges::sized_range<T>
+         && serialize_byte<std::ranges::range_value_t<T>>
+         && std::constructible_from<T, const std::ranges::range_value_t<T>*, std::size_t>;
+
+        template <typename T>
+        concept serialize_raw_contiguous_range =
+            std::ranges::contiguous_range<T>
+         && std::ranges::sized_range<T>
+         && serialize_raw<std::ranges::range_value_t<T>>;
+
+        inline auto serialize_append(std::vector<std::byte>& out, const void* data, std::size_t size) -> void
+        {
+            const auto* bytes = static_cast<const std::byte*>(data);
+            out.insert(out.end(), bytes, bytes + size);
+        }
+
+        inline auto serialize_consume(std::span<const std::byte>& in, void* data, std::size_t size) -> void
+        {
+            if (in.size() < size)
+                throw deserialize_error("refl::deserialize: unexpected end of input");
+
+            if (size != 0)
+                std::memcpy(data, in.data(), size);
+            in = in.subspan(size);
+        }
+
+    } // namespace detail
+
+    /*
+     * True if T can be written by refl::serialize and read back by refl::deserialize.
+     */
+    template <typename T>
+    constexpr bool serializable_v = []
+    {
+        if constexpr (detail::serialize_raw<T>)
+            return true;
+
+        else if constexpr (reflected<T>)
+            return type_info_<T>.data_members().apply([]<auto... Members>{
+                return (... && serializable_v<detail::layout_member_type_t<Members>>);
+            });
+
+        else if constexpr (std::ranges::view<T>)
+            return detail::serialize_borrowed_view<T>;
+
+        else if constexpr (std::ranges::sized_range<const T>)
+            return serializable_v<std::ranges::range_value_t<const T>>;
+
+        else
+            return false;
+    } ();
+
+    namespace detail
+    {
+        // Whether deserializing T leaves views into the input in it, see serialize_borrowed_view.
+        template <typename T>
+        constexpr bool serialize_borrows_v = []
+        {
+            if constexpr (serialize_raw<T>)
+                return false;
+
+            else if constexpr (reflected<T>)
+                return type_info_<T>.data_members().apply([]<auto... Members>{
+                    return (... || serialize_borrows_v<layout_member_type_t<Members>>);
+                });
+
+            else if constexpr (serialize_borrowed_view<T>)
+                return true;
+
+            else if constexpr (std::ranges::range<const T>)
+                return serialize_borrows_v<std::ranges::range_value_t<const T>>;
+
+            else
+                return false;
+        } ();
+
+    } // namespace detail
+
+    /*
+     * Appends the binary representation of value to out.
+     *
+     * The encoding is compact and not self-describing:
+     *  - arithmetic and enumeration types, arrays of them, and bytewise reflected types (see
+     *    is_bytewise_v) made of them, are written as their object representation in native byte order,
+     *  - other reflected types are written as the sequence of their data members,
+     *  - sized ranges are written as a std::uint64_t element count followed by the elements.
+     *    Contiguous ranges of raw elements are written in a single copy. Of views, only views of
+     *    bytes (e.g. std::string_view) are serializable, and are written as the bytes they view.
+     */
+    template <typename T>
+    requires serializable_v<T>
+    auto serialize(std::vector<std::byte>& out, const T& value) -> void
+    {
+        if constexpr (detail::serialize_raw<T>)
+        {
+            detail::serialize_append(out, std::addressof(value), sizeof(T));
+        }
+        else if constexpr (reflected<T>)
+        {
+            type_info_<T>.data_members().for_each([&]<auto Member>{
+                serialize(out, Member.invoke(value));
+            });
+        }
+        else
+        {
+            const auto count = static_cast<std::uint64_t>(std::ranges::size(value));
+            serialize(out, count);
+
+            if constexpr (detail::serialize_raw_contiguous_range<const T>)
+                detail::serialize_append(
+                    out, std::ranges::data(value), count * sizeof(std::ranges::range_value_t<const T>)
+                );
+            else
+                for (const auto& element : value)
+                    serialize(out, element);
+        }
+    }
+
+    /*
+     * Reads a value written by refl::serialize from the front of in, and advances in past it.
+     * Throws deserialize_error if in is too short.
+     *
+     * Ranges are refilled through resize() or clear() and insert(). Ranges of fixed size,
+     * such as std::array, must have been serialized with the same size. Views of bytes are set to
+     * view the bytes in in, which must therefore outlive them.
+     */
+    template <typename T>
+    requires serializable_v<T>
+    auto deserialize(std::span<const std::byte>& in, T& value) -> void
+    {
+        if constexpr (detail::serialize_raw<T>)
+        {
+            detail::serialize_consume(in, std::addressof(value), sizeof(T));
+        }
+        else if constexpr (reflected<T>)
+        {
+            type_info_<T>.data_members().for_each([&]<auto Member>{
+                deserialize(in, Member.invoke(value));
+            });
+        }
+        else
+        {
+            using element_type = std::ranges::range_value_t<T>;
+
+            std::uint64_t count;
+            deserialize(in, count);
+
+            if constexpr (detail::serialize_borrowed_view<T>)
+            {
+                if (in.size() < count)
+                    throw deserialize_error("refl::deserialize: unexpected end of input");
+
+                value = T(reinterpret_cast<const element_type*>(in.data()), static_cast<std::size_t>(count));
+                in = in.subspan(static_cast<std::size_t>(count));
+            }
+            else if constexpr (detail::serialize_raw_contiguous_range<T> && requires { value.resize(count); })
+            {
+                if (in.size() / sizeof(element_type) < count)
+                    throw deserialize_error("refl::deserialize: unexpected end of input");
+
+                value.resize(count);
+                detail::serialize_consume(in, std::ranges::data(value), count * sizeof(element_type));
+            }
+            else if constexpr (requires { value.clear(); value.insert(std::ranges::end(value), element_type{}); })
+            {
+                value.clear();
+                for (std::uint64_t i = 0; i < count; ++i)
+                {
+                    element_type element{};
+                    deserialize(in, element);
+                    value.insert(std::ranges::end(value), std::move(element));
+                }
+            }
+            else
+            {
+                if (count != std::ranges::size(value))
+                    throw deserialize_error("refl::deserialize: size mismatch for fixed size range");
+
+                for (auto& element : value)
+                    deserialize(in, element);
+            }
+        }
+    }
+
+    /*
+     * Serializes value into a new buffer.
+     */
+    template <typename T>
+    requires serializable_v<T>
+    auto serialize(const T& value) -> std::vector<std::byte>
+    {
+        std::vector<std::byte> out;
+        serialize(out, value);
+        return out;
+    }
+
+} // namespace lightray::refl
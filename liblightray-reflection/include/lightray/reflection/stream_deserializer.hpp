@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "meta_extraction.hpp"
+#include "serialize.hpp"
+#include "type_info.hpp"
+
+
+namespace lightray::refl
+{
+    namespace detail
+    {
+        enum class stream_status
+        {
+            done,
+            need_input,
+            pushed,
+        };
+
+        /*
+         * The position of the deserializer within one object being decoded.
+         *
+         * position is the number of bytes copied so far for raw values, the index of the next data
+         * member for reflected types, and the number of elements (or bytes, for raw contiguous
+         * ranges) decoded so far for ranges, once their element count has been read.
+         */
+        struct stream_frame
+        {
+            auto (*step)(stream_frame&, std::span<const std::byte>&, std::vector<stream_frame>&) -> stream_status;
+            void* object;
+            std::uint64_t position;
+            std::uint64_t count;
+            bool counted;
+
+        }; // struct stream_frame
+
+        template <typename T>
+        concept stream_resizable_range = requires (T& t, std::size_t n) { t.resize(n); t.clear(); };
+
+        template <typename T>
+        concept stream_growable_range = requires (T& t) { { t.emplace_back() } -> std::same_as<std::ranges::range_reference_t<T>>; t.clear(); };
+
+        template <typename T>
+        concept stream_fixed_range = std::ranges::random_access_range<T> && std::ranges::sized_range<T>;
+
+        template <typename T>
+        auto stream_step(stream_frame& frame, std::span<const std::byte>& in, std::vector<stream_frame>& frames) -> stream_status;
+
+        template <typename T>
+        auto stream_frame_for(T& object) noexcept -> stream_frame
+        {
+            return {&stream_step<T>, std::addressof(object), 0, 0, false};
+        }
+
+        // Copies as much of the remaining size - position bytes as in holds into destination + position.
+        inline auto stream_copy(std::span<const std::byte>& in, void* destination, std::uint64_t& position, std::size_t size)
+        -> bool
+        {
+            const auto n = std::min<std::size_t>(in.size(), size - position);
+            if (n != 0)
+                std::memcpy(static_cast<std::byte*>(destination) + position, in.data(), n);
+            position += n;
+            in = in.subspan(n);
+            return position == size;
+        }
+
+        template <typename T>
+        auto stream_step(stream_frame& frame, std::span<const std::byte>& in, std::vector<stream_frame>& frames) -> stream_status
+        {
+            auto& object = *static_cast<T*>(frame.object);
+
+            if constexpr (serialize_raw<T>)
+            {
+                return stream_copy(in, std::addressof(object), frame.position, sizeof(T))
+                    ? stream_status::done
+                    : stream_status::need_input;
+            }
+            else if constexpr (reflected<T>)
+            {
+                static constexpr auto push_member = type_info_<T>.data_members().apply([]<auto... Members>{
+                    return std::array<void (*)(T&, std::vector<stream_frame>&), sizeof...(Members)>{
+                        +[](T& obj, std::vector<stream_frame>& stack) {
+                            stack.push_back(stream_frame_for(Members.invoke(obj)));
+                        }...
+                    };
+                });
+
+                if (frame.position == push_member.size())
+                    return stream_status::done;
+
+                // frame is invalidated by the push.
+                push_member[frame.position++](object, frames);
+                return stream_status::pushed;
+            }
+            else
+            {
+                using element_type = std::ranges::range_value_t<T>;
+
+                if (!frame.counted)
+                {
+                    if (!stream_copy(in, &frame.count, frame.position, sizeof(frame.count)))
+                        return stream_status::need_input;
+
+                    frame.counted = true;
+                    frame.position = 0;
+
+                    if constexpr (stream_resizable_range<T> || stream_growable_range<T>)
+                        object.clear();
+                    else if (frame.count != std::ranges::size(object))
+                        throw deserialize_error("refl::stream_deserializer: size mismatch for fixed size range");
+                }
+
+                if constexpr (serialize_raw_contiguous_range<T> && (stream_resizable_range<T> || !stream_growable_range<T>))
+                {
+                    if (frame.count > std::numeric_limits<std::uint64_t>::max() / sizeof(element_type))
+                        throw deserialize_error("refl::stream_deserializer: range too large");
+
+                    // Grows with the bytes received rather than with the announced count.
+                    const auto total = frame.count * sizeof(element_type);
+                    const auto available = std::min<std::uint64_t>(in.size(), total - frame.position);
+                    if constexpr (stream_resizable_range<T>)
+                        object.resize(static_cast<std::size_t>((frame.position + available + sizeof(element_type) - 1) / sizeof(element_type)));
+
+                    stream_copy(in, std::ranges::data(object), frame.position, static_cast<std::size_t>(frame.position + available));
+                    return frame.position == total ? stream_status::done : stream_status::need_input;
+                }
+                else
+                {
+                    if (frame.position == frame.count)
+                        return stream_status::done;
+
+                    const auto i = frame.position++;
+                    if constexpr (stream_growable_range<T>)
+                        frames.push_back(stream_frame_for(object.emplace_back()));
+                    else
+                        frames.push_back(stream_frame_for(std::ranges::begin(object)[i]));
+                    return stream_status::pushed;
+                }
+            }
+        }
+
+    } // namespace detail
+
+    /*
+     * True if T can be decoded by stream_deserializer.
+     * This is serializable_v<T>, except that ranges must either be contiguous ranges of raw
+     * elements, provide emplace_back() (e.g. std::vector, std::deque), or be of fixed size, and
+     * must not be views, as the decoder keeps no input for them to view.
+     */
+    template <typename T>
+    constexpr bool stream_deserializable_v = []
+    {
+        if constexpr (!serializable_v<T>)
+            return false;
+
+        else if constexpr (detail::serialize_raw<T>)
+            return true;
+
+        else if constexpr (reflected<T>)
+            return type_info_<T>.data_members().apply([]<auto... Members>{
+                return (... && stream_deserializable_v<detail::layout_member_type_t<Members>>);
+            });
+
+        else if constexpr (std::ranges::view<T>)
+            return false;
+
+        else if constexpr (detail::serialize_raw_contiguous_range<T> && detail::stream_resizable_range<T>)
+            return true;
+
+        else if constexpr (detail::stream_growable_range<T> || detail::stream_fixed_range<T>)
+            return stream_deserializable_v<std::ranges::range_value_t<T>>;
+
+        else
+            return false;
+    } ();
+
+    /*
+     * A resumable decoder for the binary encoding of refl::serialize, for input which arrives
+     * in chunks, e.g. from a non-blocking socket:
+     *
+     *  T message;
+     *  stream_deserializer decoder(message);
+     *  while (!decoder.done())
+     *      decoder.feed(std::span{buffer}.first(read(socket, buffer)));
+     *
+     * The decoder writes straight into its target and keeps, between calls to feed, only a stack
+     * with one small frame per level of nesting being decoded (current member, element or byte).
+     * It never buffers input: a value split across chunks is copied into place piecewise, and
+     * ranges grow with the data actually received rather than with their announced size.
+     */
+    template <typename T>
+    requires stream_deserializable_v<T>
+    class stream_deserializer
+    {
+    private:
+        T* _target;
+        std::vector<detail::stream_frame> _frames;
+
+    public:
+        explicit stream_deserializer(T& target) : _target(std::addressof(target))
+        {
+            reset();
+        }
+
+        /*
+         * Starts decoding a new value into the target.
+         */
+        auto reset() -> void
+        {
+            _frames.clear();
+            _frames.push_back(detail::stream_frame_for(*_target));
+        }
+
+        /*
+         * True once a whole value has been decoded.
+         */
+        auto done() const noexcept -> bool
+        {
+            return _frames.empty();
+        }
+
+        /*
+         * Decodes as much of chunk as belongs to the current value, and returns the number of
+         * bytes consumed. Fewer than chunk.size() bytes are consumed only if the value is done,
+         * in which case the rest belongs to whatever follows it in the stream.
+         * Throws deserialize_error if the input is malformed.
+         */
+        auto feed(std::span<const std::byte> chunk) -> std::size_t
+        {
+            const auto size = chunk.size();
+            while (!_frames.empty())
+            {
+                auto& frame = _frames.back();
+                const auto status = frame.step(frame, chunk, _frames);
+
+                if (status == detail::stream_status::done)
+                    _frames.pop_back();
+
+                else if (status == detail::stream_status::need_input)
+                    break;
+            }
+            return size - chunk.size();
+        }
+
+    }; // class stream_deserializer
+
+} // namespace lightray::refl
@@ -0,0 +1,473 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <new>
+#include <semaphore>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+
+namespace lightray::refl
+{
+    /*
+     * A cache of coroutine frames, in size classes of frame_pool::granularity bytes.
+     *
+     * Frames are taken from and returned to per-size-class free lists, so that once a pool has
+     * seen its working set of frames, creating a coroutine does not allocate. Frames larger than
+     * max_frame_size go to the global operator new.
+     *
+     * A pool belongs to the thread which created it, and only that thread may allocate from it,
+     * directly, through a frame_pool_scope or by passing it to a coroutine. Frames freed by another
+     * thread, e.g. when a coroutine completes on a different thread than it started on, are handed
+     * back to the owner through a lock-free list. A pool must outlive every frame allocated from it.
+     */
+    class frame_pool
+    {
+    public:
+        static constexpr std::size_t granularity = 64;
+        static constexpr std::size_t max_frame_size = 4096;
+
+    private:
+        static constexpr std::size_t class_count = max_frame_size / granularity;
+        static constexpr std::uint32_t oversized = class_count;
+
+        struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) header
+        {
+            frame_pool* pool;
+            std::uint32_t size_class;
+        };
+
+        struct free_node
+        {
+            free_node* next;
+            std::uint32_t size_class;
+        };
+
+        std::array<free_node*, class_count> _free{};
+        std::atomic<free_node*> _remote_free = nullptr;
+        std::thread::id _owner = std::this_thread::get_id();
+
+        static inline thread_local frame_pool* t_current = nullptr;
+
+        auto drain_remote() noexcept -> void
+        {
+            for (auto* node = _remote_free.exchange(nullptr, std::memory_order_acquire); node;)
+            {
+                auto* next = node->next;
+                node->next = _free[node->size_class];
+                _free[node->size_class] = node;
+                node = next;
+            }
+        }
+
+    public:
+        frame_pool() = default;
+        frame_pool(const frame_pool&) = delete;
+        auto operator=(const frame_pool&) -> frame_pool& = delete;
+
+        ~frame_pool()
+        {
+            drain_remote();
+            for (auto* node : _free)
+                while (node)
+                    ::operator delete(std::exchange(node, node->next));
+        }
+
+        /*
+         * The pool of the calling thread, used by task<T> unless a frame_pool_scope is active.
+         */
+        static auto this_thread() noexcept -> frame_pool&
+        {
+            static thread_local frame_pool pool;
+            return pool;
+        }
+
+        /*
+         * The pool task<T> coroutines started on this thread allocate from.
+         */
+        static auto current() noexcept -> frame_pool&
+        {
+            return t_current ? *t_current : this_thread();
+        }
+
+        // Must be called by the owner thread, see above.
+        auto allocate(std::size_t size) -> void*
+        {
+            assert(std::this_thread::get_id() == _owner && "frame_pool: allocating from a pool owned by another thread");
+
+            const auto total = size + sizeof(header);
+            const auto size_class = total <= max_frame_size
+                ? static_cast<std::uint32_t>((total - 1) / granularity)
+                : oversized;
+
+            void* block = nullptr;
+            if (size_class != oversized)
+            {
+                if (!_free[size_class])
+                    drain_remote();
+
+                if (auto* node = _free[size_class])
+                {
+                    _free[size_class] = node->next;
+                    block = node;
+                }
+                else
+                    block = ::operator new((size_class + 1) * granularity);
+            }
+            else
+                block = ::operator new(total);
+
+            auto* h = ::new (block) header{this, size_class};
+            return h + 1;
+        }
+
+        static auto deallocate(void* frame) noexcept -> void
+        {
+            auto* h = static_cast<header*>(frame) - 1;
+            auto* pool = h->pool;
+            const auto size_class = h->size_class;
+
+            if (size_class == oversized)
+            {
+                ::operator delete(h);
+                return;
+            }
+
+            auto* node = ::new (static_cast<void*>(h)) free_node{nullptr, size_class};
+            if (std::this_thread::get_id() == pool->_owner)
+            {
+                node->next = pool->_free[size_class];
+                pool->_free[size_class] = node;
+            }
+            else
+            {
+                node->next = pool->_remote_free.load(std::memory_order_relaxed);
+                while (!pool->_remote_free.compare_exchange_weak(
+                    node->next, node, std::memory_order_release, std::memory_order_relaxed
+                ));
+            }
+        }
+
+        friend class frame_pool_scope;
+
+    }; // class frame_pool
+
+    /*
+     * Makes task<T> coroutines started on this thread allocate from pool for the lifetime
+     * of the scope, e.g. a pool dedicated to the implementation behind one dyn<Prototype>.
+     * pool must be owned by this thread.
+     */
+    class frame_pool_scope
+    {
+    private:
+        frame_pool* _previous;
+
+    public:
+        explicit frame_pool_scope(frame_pool& pool) noexcept
+        :   _previous(std::exchange(frame_pool::t_current, &pool))
+        {
+            assert(std::this_thread::get_id() == pool._owner && "frame_pool_scope: the pool is owned by another thread");
+        }
+
+        frame_pool_scope(const frame_pool_scope&) = delete;
+        auto operator=(const frame_pool_scope&) -> frame_pool_scope& = delete;
+
+        ~frame_pool_scope()
+        {
+            frame_pool::t_current = _previous;
+        }
+
+    }; // class frame_pool_scope
+
+    template <typename T = void>
+    class task;
+
+    namespace detail
+    {
+        // Resumes whichever coroutine awaited the task, by symmetric transfer.
+        struct task_final_awaiter
+        {
+            auto await_ready() const noexcept -> bool { return false; }
+
+            template <typename Promise>
+            auto await_suspend(std::coroutine_handle<Promise> handle) const noexcept -> std::coroutine_handle<>
+            {
+                return handle.promise().continuation;
+            }
+
+            auto await_resume() const noexcept -> void {}
+
+        }; // struct task_final_awaiter
+
+        struct task_promise_base
+        {
+            std::coroutine_handle<> continuation = std::noop_coroutine();
+
+            // Frames come from frame_pool::current(), or from an explicit pool passed as
+            // (std::allocator_arg, pool, ...) in front of the coroutine's parameters.
+            static auto operator new(std::size_t size) -> void*
+            {
+                return frame_pool::current().allocate(size);
+            }
+
+            template <typename... Args>
+            static auto operator new(std::size_t size, std::allocator_arg_t, frame_pool& pool, Args&&...) -> void*
+            {
+                return pool.allocate(size);
+            }
+
+            template <typename Self, typename... Args>
+            static auto operator new(std::size_t size, Self&&, std::allocator_arg_t, frame_pool& pool, Args&&...) -> void*
+            {
+                return pool.allocate(size);
+            }
+
+            static auto operator delete(void* frame) noexcept -> void
+            {
+                frame_pool::deallocate(frame);
+            }
+
+            auto initial_suspend() const noexcept -> std::suspend_always { return {}; }
+
+            auto final_suspend() const noexcept -> task_final_awaiter { return {}; }
+
+        }; // struct task_promise_base
+
+        template <typename T>
+        struct task_promise : task_promise_base
+        {
+            std::variant<std::monostate, T, std::exception_ptr> result;
+
+            auto get_return_object() noexcept -> task<T>;
+
+            template <typename U>
+            auto return_value(U&& value) -> void
+            {
+                result.template emplace<1>(std::forward<U>(value));
+            }
+
+            auto unhandled_exception() noexcept -> void
+            {
+                result.template emplace<2>(std::current_exception());
+            }
+
+            auto take() -> T
+            {
+                if (result.index() == 2)
+                    std::rethrow_exception(std::get<2>(result));
+                return std::move(std::get<1>(result));
+            }
+
+        }; // struct task_promise
+
+        template <>
+        struct task_promise<void> : task_promise_base
+        {
+            std::exception_ptr error;
+
+            auto get_return_object() noexcept -> task<void>;
+
+            auto return_void() noexcept -> void {}
+
+            auto unhandled_exception() noexcept -> void
+            {
+                error = std::current_exception();
+            }
+
+            auto take() -> void
+            {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+
+        }; // struct task_promise<void>
+
+    } // namespace detail
+
+    /*
+     * A lazily started coroutine producing a T, whose frame is allocated from a frame_pool.
+     *
+     * A task starts when it is first awaited, and resumes its awaiter by symmetric transfer when
+     * it completes, so chains of awaiting tasks neither allocate beyond their frames nor grow the
+     * stack. Exceptions escaping the coroutine are rethrown to the awaiter.
+     *
+     * task<T> is an ordinary return type, and can be used as such in the signature of an
+     * interface_proxy, e.g. interface_proxy((refl::task<int>)((int)(key))()), in which case
+     * calling through dyn<Prototype> returns the implementation's task as is.
+     */
+    template <typename T>
+    class [[nodiscard]] task
+    {
+    public:
+        using promise_type = detail::task_promise<T>;
+
+    private:
+        std::coroutine_handle<promise_type> _handle;
+
+    public:
+        explicit task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+
+        task(task&& other) noexcept : _handle(std::exchange(other._handle, nullptr)) {}
+
+        auto operator=(task&& other) noexcept -> task&
+        {
+            if (this != &other)
+            {
+                if (_handle)
+                    _handle.destroy();
+                _handle = std::exchange(other._handle, nullptr);
+            }
+            return *this;
+        }
+
+        ~task()
+        {
+            if (_handle)
+                _handle.destroy();
+        }
+
+        auto done() const noexcept -> bool
+        {
+            return !_handle || _handle.done();
+        }
+
+        auto operator co_await() && noexcept -> auto
+        {
+            struct awaiter
+            {
+                std::coroutine_handle<promise_type> handle;
+
+                auto await_ready() const noexcept -> bool { return false; }
+
+                auto await_suspend(std::coroutine_handle<> awaiting) const noexcept -> std::coroutine_handle<>
+                {
+                    handle.promise().continuation = awaiting;
+                    return handle;
+                }
+
+                auto await_resume() const -> T
+                {
+                    return handle.promise().take();
+                }
+            };
+            return awaiter{_handle};
+        }
+
+    }; // class task
+
+    namespace detail
+    {
+        template <typename T>
+        auto task_promise<T>::get_return_object() noexcept -> task<T>
+        {
+            return task<T>{std::coroutine_handle<task_promise<T>>::from_promise(*this)};
+        }
+
+        inline auto task_promise<void>::get_return_object() noexcept -> task<void>
+        {
+            return task<void>{std::coroutine_handle<task_promise<void>>::from_promise(*this)};
+        }
+
+        // Coroutine driving sync_wait, which signals a semaphore once the awaited task completes.
+        struct task_sync_waiter
+        {
+            struct promise_type
+            {
+                std::binary_semaphore* done;
+
+                static auto operator new(std::size_t size) -> void*
+                {
+                    return frame_pool::current().allocate(size);
+                }
+
+                static auto operator delete(void* frame) noexcept -> void
+                {
+                    frame_pool::deallocate(frame);
+                }
+
+                auto get_return_object() noexcept -> task_sync_waiter
+                {
+                    return {std::coroutine_handle<promise_type>::from_promise(*this)};
+                }
+
+                auto initial_suspend() const noexcept -> std::suspend_always { return {}; }
+
+                auto final_suspend() const noexcept -> auto
+                {
+                    struct awaiter
+                    {
+                        auto await_ready() const noexcept -> bool { return false; }
+
+                        auto await_suspend(std::coroutine_handle<promise_type> handle) const noexcept -> void
+                        {
+                            handle.promise().done->release();
+                        }
+
+                        auto await_resume() const noexcept -> void {}
+                    };
+                    return awaiter{};
+                }
+
+                auto return_void() noexcept -> void {}
+
+                auto unhandled_exception() noexcept -> void { std::terminate(); }
+            };
+
+            std::coroutine_handle<promise_type> handle;
+
+        }; // struct task_sync_waiter
+
+        template <typename T>
+        auto task_sync_wait_impl(task<T>& t, std::variant<std::monostate, std::conditional_t<std::is_void_v<T>, std::monostate, T>, std::exception_ptr>& out)
+        -> task_sync_waiter
+        {
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    co_await std::move(t);
+                    out.template emplace<1>();
+                }
+                else
+                    out.template emplace<1>(co_await std::move(t));
+            }
+            catch (...)
+            {
+                out.template emplace<2>(std::current_exception());
+            }
+        }
+
+    } // namespace detail
+
+    /*
+     * Runs t to completion, blocking the calling thread until it completes if it is resumed
+     * elsewhere, and returns its result.
+     */
+    template <typename T>
+    auto sync_wait(task<T> t) -> T
+    {
+        std::variant<std::monostate, std::conditional_t<std::is_void_v<T>, std::monostate, T>, std::exception_ptr> result;
+        std::binary_semaphore done{0};
+
+        auto waiter = detail::task_sync_wait_impl(t, result);
+        waiter.handle.promise().done = &done;
+        waiter.handle.resume();
+        done.acquire();
+        waiter.handle.destroy();
+
+        if (result.index() == 2)
+            std::rethrow_exception(std::get<2>(result));
+        if constexpr (!std::is_void_v<T>)
+            return std::move(std::get<1>(result));
+    }
+
+} // namespace lightray::refl
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <utility>
+
+#include <lightray/metaprogramming/fixed_string.hpp>
+#include <lightray/metaprogramming/inherit_from.hpp>
+#include <lightray/metaprogramming/tags.hpp>
+#include <lightray/metaprogramming/type.hpp>
+#include <lightray/metaprogramming/value.hpp>
+
+#include "meta_extraction.hpp"
+#include "type_info.hpp"
+
+namespace lightray::refl
+{
+    /*
+     * An observer for refl::tracked which calls fn with the new value of the member named Name
+     * whenever it is written, and is not invocable for any other member.
+     */
+    template <mtp::fixed_string Name, typename Fn>
+    struct member_observer
+    {
+        [[no_unique_address]] Fn fn;
+
+        template <typename MemberInfo, typename Value>
+        requires (MemberInfo::name() == Name) && std::invocable<Fn&, const Value&>
+        constexpr auto operator()(MemberInfo, const Value& value) -> void
+        {
+            std::invoke(fn, value);
+        }
+
+    }; // struct member_observer
+
+    template <mtp::fixed_string Name, typename Fn>
+    constexpr auto observe(Fn fn) -> member_observer<Name, Fn>
+    {
+        return {std::move(fn)};
+    }
+
+    namespace detail
+    {
+        template <typename T>
+        using tracked_word_array = std::array<std::uint64_t, (type_info_<T>.member_count() + 63) / 64>;
+
+        // The bits of the last word of a tracked_word_array<T> which stand for a member.
+        template <typename T>
+        constexpr std::uint64_t tracked_last_word_mask = type_info_<T>.member_count() % 64 == 0
+            ? ~std::uint64_t{0}
+            : (std::uint64_t{1} << type_info_<T>.member_count() % 64) - 1;
+
+        // Inherits the proxies of the members which declare one.
+        template <reflected T, typename Derived>
+        constexpr auto tracked_base_type() noexcept -> auto
+        {
+            return type_info_<T>.members()
+                .filter([]<auto Member>{
+                    return mtp::value<!std::same_as<decltype(Member.template proxy_type<Derived>()), mtp::none_t>>;
+                })
+                .apply([]<auto... Members>{
+                    using mtp::splice::type::decl_t;
+                    return mtp::type<mtp::inherit_from<decl_t<Members.template proxy_type<Derived>()>...>>;
+                });
+        }
+
+    } // namespace detail
+
+    /*
+     * A wrapper around a value of reflected type T which records which of its members were
+     * written since the last call to clear_dirty().
+     *
+     * Like refl::builder, each member declared with the proxy metadata is exposed as a proxy
+     * function of the same name: t.x(value) assigns value to the member x and marks it dirty,
+     * and t.x() reads it. Members are marked in an inline bitset indexed by member_info_t::index().
+     *
+     * Each observer in Observers is called as observer(member_info, new_value) after a member is
+     * written, if it is invocable with those arguments. Observers are resolved at compile time,
+     * so a write to a member that no observer accepts costs only the assignment and the bit.
+     * See refl::observe for observing a single member by name.
+     */
+    template <reflected T, typename... Observers>
+    struct tracked : mtp::splice::type::decl_t<detail::tracked_base_type<T, tracked<T, Observers...>>()>
+    {
+    private:
+        T _data;
+        detail::tracked_word_array<T> _dirty{};
+        [[no_unique_address]] std::tuple<Observers...> _observers;
+
+        template <typename MemberInfo>
+        constexpr auto notify(MemberInfo info) -> void
+        {
+            const auto& value = info.invoke(_data);
+            std::apply([&](auto&... observers) {
+                ([&] {
+                    if constexpr (std::invocable<decltype(observers)&, MemberInfo, decltype(value)>)
+                        std::invoke(observers, info, value);
+                } (), ...);
+            }, _observers);
+        }
+
+    public:
+        constexpr tracked() = default;
+
+        constexpr explicit tracked(T data, Observers... observers)
+        :   _data(std::move(data)), _observers(std::move(observers)...)
+        {}
+
+        // Proxy setter: assigns to the member and marks it dirty.
+        template <typename MemberInfo, typename TAssigned>
+        constexpr auto on_proxy_invoked(MemberInfo info, TAssigned&& assigned) -> tracked&
+        {
+            info.invoke(_data) = std::forward<TAssigned>(assigned);
+            mark_dirty(info.index());
+            notify(info);
+            return *this;
+        }
+
+        // Proxy getter.
+        template <typename MemberInfo>
+        constexpr auto on_proxy_invoked(MemberInfo info) const noexcept -> const auto&
+        {
+            return info.invoke(_data);
+        }
+
+        constexpr auto get() const noexcept -> const T&
+        {
+            return _data;
+        }
+
+        constexpr auto move_get() noexcept -> T&&
+        {
+            return std::move(_data);
+        }
+
+        constexpr auto is_dirty(std::size_t member_index) const noexcept -> bool
+        {
+            assert(member_index < type_info_<T>.member_count());
+            return (_dirty[member_index / 64] >> (member_index % 64)) & 1;
+        }
+
+        constexpr auto any_dirty() const noexcept -> bool
+        {
+            for (auto word : _dirty)
+                if (word)
+                    return true;
+            return false;
+        }
+
+        // member_index must be the index() of a member of T.
+        constexpr auto mark_dirty(std::size_t member_index) noexcept -> void
+        {
+            assert(member_index < type_info_<T>.member_count());
+            _dirty[member_index / 64] |= std::uint64_t{1} << (member_index % 64);
+        }
+
+        constexpr auto clear_dirty() noexcept -> void
+        {
+            _dirty = {};
+        }
+
+        /*
+         * Calls fn.template operator()<Member>() for each dirty data member, in declaration order.
+         *
+         * Only the set bits are visited, each dispatching through a table of one
+         * function pointer per member, so the cost is proportional to the number of dirty members.
+         */
+        template <typename Fn>
+        auto for_each_dirty(Fn&& fn) const -> void
+        {
+            using fn_type = std::remove_reference_t<Fn>;
+
+            static constexpr auto table = type_info_<T>.members().apply([]<auto... Members>{
+                return std::array<void (*)(fn_type&), sizeof...(Members)>{
+                    [] {
+                        if constexpr (std::is_member_object_pointer_v<decltype(Members.pointer())>)
+                            return +[](fn_type& f) { f.template operator()<Members>(); };
+                        else
+                            return static_cast<void (*)(fn_type&)>(nullptr);
+                    } ()...
+                };
+            });
+
+            for (std::size_t w = 0; w < _dirty.size(); ++w)
+            {
+                auto word = _dirty[w];
+                if (w + 1 == _dirty.size())
+                    word &= detail::tracked_last_word_mask<T>;
+
+                for (; word; word &= word - 1)
+                    if (auto entry = table[w * 64 + std::countr_zero(word)])
+                        entry(fn);
+            }
+        }
+
+    }; // struct tracked
+
+} // namespace lightray::refl
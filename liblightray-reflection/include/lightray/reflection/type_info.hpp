@@ -4,11 +4,14 @@
 #include <tuple>
 #include <type_traits>
 
+#include <lightray/metaprogramming/fixed_string.hpp>
 #include <lightray/metaprogramming/tags.hpp>
 #include <lightray/metaprogramming/type_pack.hpp>
+#include <lightray/metaprogramming/value.hpp>
 #include <lightray/metaprogramming/value_pack.hpp>
 
 #include "member_info.hpp"
+#include "meta_category.hpp"
 #include "meta_extraction.hpp"
 
 
@@ -72,6 +75,27 @@ namespace lightray::refl
             return meta_type_t<T>::name();
         }
 
+        template <reflected T>
+        constexpr auto type_info_qualified_name() noexcept -> auto
+        {
+            using namespace mtp::splice::type;
+
+            if constexpr (std::is_same_v<decltype(type_info_declaring_type<T>()), mtp::none_t>)
+            {
+                constexpr auto namespace_name = type_info_meta_namespace_name<T>();
+
+                if constexpr (namespace_name.ends_with("::") || namespace_name == mtp::fixed_string(""))
+                    return namespace_name + type_info_name<T>();
+                else
+                    return namespace_name + "::" + type_info_name<T>();
+            }
+            else if constexpr (reflected<decl_t<type_info_declaring_type<T>()>>)
+                return type_info_qualified_name<decl_t<type_info_declaring_type<T>()>>() + "::" + type_info_name<T>();
+
+            else
+                return type_info_name<T>();
+        }
+
         template <reflected T>
         constexpr auto type_info_category() noexcept -> meta_category
         {
@@ -92,6 +116,17 @@ namespace lightray::refl
             });
         }
 
+        template <reflected T>
+        constexpr auto type_info_data_members() noexcept -> auto
+        {
+            return type_info_members<T>().filter([]<auto M>{
+                if constexpr (M.category() != meta_category::variable)
+                    return mtp::false_;
+                else
+                    return mtp::value<std::is_member_object_pointer_v<decltype(M.pointer())>>;
+            });
+        }
+
         template <reflected T>
         constexpr auto type_info_bases() noexcept -> auto
         {
@@ -167,6 +202,13 @@ namespace lightray::refl
             return detail::type_info_name<T>();
         }
 
+        // The name of T qualified by its namespace and declaring types as a single fixed_string,
+        // e.g. "::game::scene::node". Only name() if T is declared in a type which is not reflected.
+        static constexpr auto qualified_name() noexcept -> auto
+        {
+            return detail::type_info_qualified_name<T>();
+        }
+
         static constexpr auto category() noexcept -> meta_category
         {
             return detail::type_info_category<T>();
@@ -182,6 +224,12 @@ namespace lightray::refl
             return detail::type_info_members<T>();
         }
 
+        // The non-static variable members, in declaration order.
+        static constexpr auto data_members() noexcept -> auto
+        {
+            return detail::type_info_data_members<T>();
+        }
+
         static constexpr auto bases() noexcept -> auto
         {
             return detail::type_info_bases<T>();
@@ -0,0 +1,126 @@
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <numeric>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <unistd.h>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/columnar.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct tick
+{
+    std::uint64_t timestamp;
+    std::uint32_t symbol;
+    double price;
+    std::int32_t quantity;
+    char venue[4];
+
+    LIGHTRAY_REFL_TYPE(namespace(::), tick, (),
+        (var, timestamp, ())
+        (var, symbol, ())
+        (var, price, ())
+        (var, quantity, ())
+        (var, venue, ())
+    )
+
+}; // struct tick
+
+struct other_tick
+{
+    std::uint64_t timestamp;
+    float price;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), other_tick, (),
+        (var, timestamp, ())
+        (var, price, ())
+    )
+
+}; // struct other_tick
+
+static const auto path = std::filesystem::temp_directory_path() / ("lightray_columnar_" + std::to_string(::getpid()));
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_roundtrip)
+    {
+        {
+            columnar::writer<tick> w(path);
+            for (std::uint32_t i = 0; i < 10000; ++i)
+                w.push_back({i * 1000ull, i % 7, 100.0 + i, static_cast<std::int32_t>(i), {'X', 'N', 'Y', 'S'}});
+        }
+
+        columnar::reader<tick> r(path);
+        assert_true(r.size() == 10000, "");
+
+        const auto prices = r.column<"price">();
+        const auto quantities = r.column<"quantity">();
+        static_assert(std::is_same_v<decltype(prices), const std::span<const double>>);
+
+        assert_true(prices.size() == 10000, "");
+        assert_true(prices[42] == 142.0, "");
+        assert_true(std::accumulate(quantities.begin(), quantities.end(), std::int64_t{0}) == 49995000, "");
+        assert_true(r.column<"venue">()[9999][3] == 'S', "");
+        assert_true(reinterpret_cast<std::uintptr_t>(prices.data()) % columnar::column_alignment == 0, "");
+    };
+
+    lr_test_case(tests, test_schema_mismatch)
+    {
+        bool thrown = false;
+        try { columnar::reader<other_tick> r(path); } catch (const columnar::format_error&) { thrown = true; }
+        assert_true(thrown, "reading with a different record type must be rejected");
+
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+        thrown = false;
+        try { columnar::reader<tick> r(path); } catch (const columnar::format_error&) { thrown = true; }
+        assert_true(thrown, "truncated files must be rejected");
+
+        thrown = false;
+        try { columnar::reader<tick> r(path.string() + ".missing"); } catch (const std::system_error&) { thrown = true; }
+        assert_true(thrown, "");
+    };
+
+    lr_test_case(tests, test_close_retry)
+    {
+        const auto retried = std::filesystem::path(path).concat(".retried");
+        std::filesystem::create_directory(retried);
+
+        columnar::writer<tick> w(retried);
+        for (std::uint32_t i = 0; i < 100; ++i)
+            w.push_back({i, 0, 1.0, 1, {}});
+
+        bool thrown = false;
+        try { w.close(); } catch (const std::system_error&) { thrown = true; }
+        assert_true(thrown, "a directory cannot be written as the file");
+
+        std::filesystem::remove(retried);
+        w.close();
+        assert_true(columnar::reader<tick>(retried).column<"quantity">().size() == 100, "a failed close must keep the records");
+        assert_true(!std::filesystem::exists(std::filesystem::path(retried).concat(".column0")), "spill files must not be left behind");
+
+        std::filesystem::remove(retried);
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+    std::filesystem::remove(path);
+
+} // fn main
@@ -0,0 +1,125 @@
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/compare.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct trade
+{
+    std::uint64_t id;
+    std::uint32_t venue;
+    std::uint8_t side;
+    std::uint8_t flags;
+    // 2 bytes of padding
+    std::int64_t quantity;
+    double price;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), trade, (),
+        (var, id, ())
+        (var, venue, ())
+        (var, side, ())
+        (var, flags, ())
+        (var, quantity, ())
+        (var, price, ())
+    )
+
+}; // struct trade
+
+struct tagged_trade
+{
+    std::string tag;
+    trade value;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), tagged_trade, (),
+        (var, tag, ())
+        (var, value, ())
+    )
+
+}; // struct tagged_trade
+
+// id, venue, side and flags are one memcmp run, quantity is cut off by padding, price is a double.
+static_assert(detail::compare_runs<trade>.count == 3);
+static_assert(detail::compare_runs<trade>.runs[0].bytewise);
+static_assert(detail::compare_runs<trade>.runs[0].size == 14);
+static_assert(detail::compare_runs<trade>.runs[1].bytewise);
+static_assert(!detail::compare_runs<trade>.runs[2].bytewise);
+
+static_assert(std::is_same_v<decltype(compare(trade{}, trade{})), std::partial_ordering>);
+static_assert(std::is_same_v<decltype(compare(tagged_trade{}, tagged_trade{})), std::partial_ordering>);
+
+static_assert(equal(trade{1, 2, 3, 4, 5, 6.0}, trade{1, 2, 3, 4, 5, 6.0}));
+static_assert(compare(trade{1, 2, 3, 4, 5, 6.0}, trade{1, 2, 4, 0, 0, 0.0}) < 0);
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_equal)
+    {
+        trade a, b;
+        std::memset(&a, 0x00, sizeof(a));
+        std::memset(&b, 0xff, sizeof(b));
+        a = b = {1, 2, 3, 4, 5, 6.0};
+        // trade has no padding between the memcmp'd bytes, but padding elsewhere must not matter.
+        std::memset(reinterpret_cast<unsigned char*>(&a) + 14, 0x00, 2);
+        std::memset(reinterpret_cast<unsigned char*>(&b) + 14, 0xff, 2);
+        assert_true(equal(a, b), "padding must be ignored");
+
+        b.flags = 5;
+        assert_true(!equal(a, b), "a difference inside a memcmp run must be detected");
+
+        b = a;
+        b.price = -0.0;
+        a.price = 0.0;
+        assert_true(equal(a, b), "floating point members must be compared by value");
+
+        tagged_trade c = {"x", a}, d = {"x", a};
+        assert_true(equal(c, d), "");
+        d.tag = "y";
+        assert_true(!equal(c, d), "");
+    };
+
+    lr_test_case(tests, test_compare)
+    {
+        const trade a = {1, 2, 3, 4, 5, 6.0};
+
+        trade b = a;
+        assert_true(compare(a, b) == 0, "");
+
+        // on little-endian targets, byte order differs from value order.
+        assert_true(compare(trade{1, 0x001, 0, 0, 0, 0}, trade{1, 0x100, 0, 0, 0, 0}) < 0, "");
+        assert_true(compare(trade{1, 0x100, 0, 0, 0, 0}, trade{1, 0x001, 0, 0, 0, 0}) > 0, "");
+
+        b = a;
+        b.quantity = -1;
+        assert_true(compare(a, b) > 0, "");
+
+        b = a;
+        b.price = std::numeric_limits<double>::quiet_NaN();
+        assert_true(compare(a, b) == std::partial_ordering::unordered, "");
+
+        assert_true(compare(tagged_trade{"a", a}, tagged_trade{"b", a}) < 0, "");
+        assert_true(compare(tagged_trade{"a", a}, tagged_trade{"a", b}) == std::partial_ordering::unordered, "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
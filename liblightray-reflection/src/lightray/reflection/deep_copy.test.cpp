@@ -0,0 +1,156 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/compare.hpp>
+#include <lightray/reflection/deep_copy.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct particle
+{
+    float position[3];
+    float velocity[3];
+    std::uint32_t id;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), particle, (),
+        (var, position, ())
+        (var, velocity, ())
+        (var, id, ())
+    )
+
+}; // struct particle
+
+struct emitter
+{
+    std::pmr::string name;
+    std::pmr::vector<particle> particles;
+    std::vector<int> tags;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), emitter, (),
+        (var, name, ())
+        (var, particles, ())
+        (var, tags, ())
+    )
+
+}; // struct emitter
+
+struct scene
+{
+    std::uint64_t frame;
+    std::pmr::vector<emitter> emitters;
+    particle origin;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), scene, (),
+        (var, frame, ())
+        (var, emitters, ())
+        (var, origin, ())
+    )
+
+}; // struct scene
+
+struct labelled
+{
+    std::string labels[4];
+    std::pmr::string notes[2];
+
+    LIGHTRAY_REFL_TYPE(namespace(::), labelled, (),
+        (var, labels, ())
+        (var, notes, ())
+    )
+
+}; // struct labelled
+
+static auto make_scene() -> scene
+{
+    scene s{};
+    s.frame = 60;
+    s.emitters.resize(3);
+    for (std::size_t i = 0; i < s.emitters.size(); ++i)
+    {
+        s.emitters[i].name = "an emitter name too long for the small string buffer";
+        s.emitters[i].particles.resize(100 * (i + 1));
+        s.emitters[i].particles.back().id = static_cast<std::uint32_t>(i);
+        s.emitters[i].tags = {1, 2, 3};
+    }
+    s.origin.id = 7;
+    return s;
+}
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_deep_copy)
+    {
+        const auto src = make_scene();
+        scene dst = make_scene();
+        dst.emitters[0].particles.resize(1000);
+        dst.emitters.resize(5);
+        const auto* reused = dst.emitters[1].particles.data();
+
+        deep_copy(src, dst);
+        assert_true(equal(src, dst), "");
+        assert_true(dst.emitters[1].particles.data() == reused, "existing storage must be reused");
+    };
+
+    lr_test_case(tests, test_deep_copy_array)
+    {
+        const labelled src{{"a", "b", "c", "a label too long for the small string buffer"}, {"x", "y"}};
+        labelled dst{};
+
+        deep_copy(src, dst);
+        for (std::size_t i = 0; i < 4; ++i)
+            assert_true(dst.labels[i] == src.labels[i], "");
+        assert_true(dst.notes[0] == "x" && dst.notes[1] == "y", "");
+
+        std::array<std::byte, 1 << 10> buffer;
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+        const labelled* clone = clone_into(arena, src);
+        assert_true(clone->labels[3] == src.labels[3], "");
+        assert_true(clone->notes[1].get_allocator().resource() == &arena, "array elements must be rebound to the arena");
+    };
+
+    lr_test_case(tests, test_clone_into)
+    {
+        const auto src = make_scene();
+
+        std::array<std::byte, 1 << 16> buffer;
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+        const scene* clone = clone_into(arena, src);
+        assert_true(equal(src, *clone), "");
+
+        const auto in_arena = [&](const void* p) {
+            return p >= buffer.data() && p < buffer.data() + buffer.size();
+        };
+        assert_true(in_arena(clone), "");
+        assert_true(clone->emitters.get_allocator().resource() == &arena, "");
+        assert_true(in_arena(clone->emitters.data()), "");
+        for (const auto& e : clone->emitters)
+        {
+            assert_true(in_arena(e.particles.data()), "nested storage must come from the arena");
+            assert_true(in_arena(e.name.data()), "");
+        }
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
@@ -55,6 +55,9 @@ public:
 
 }; // struct basic_dog
 
+// Vtables are instantiated in each translation unit unless declared extern, see tests/dyn-extern.
+static_assert(!refl::detail::dyn_vtable_is_extern<basic_cat, basic_prototype>);
+
 int main()
 {
     test_case_database tests;
@@ -0,0 +1,205 @@
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/metaprogramming/work_stealing_executor.hpp>
+#include <lightray/reflection/ecs.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct position
+{
+    float x;
+    float y;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), position, (),
+        (var, x, ())
+        (var, y, ())
+    )
+
+}; // struct position
+
+struct velocity
+{
+    float dx;
+    float dy;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), velocity, (),
+        (var, dx, ())
+        (var, dy, ())
+    )
+
+}; // struct velocity
+
+struct label
+{
+    std::string text;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), label, (),
+        (var, text, ())
+    )
+
+}; // struct label
+
+// Counts the objects alive, to check that none is leaked or destroyed twice.
+struct tracked
+{
+    static inline int alive = 0;
+
+    int id;
+
+    tracked(int id) : id(id) { ++alive; }
+    tracked(const tracked& other) : id(other.id) { ++alive; }
+    tracked(tracked&& other) : id(other.id) { ++alive; }
+    ~tracked() { --alive; }
+
+    LIGHTRAY_REFL_TYPE(namespace(::), tracked, (),
+        (var, id, ())
+    )
+
+}; // struct tracked
+
+// Throws when moved, as when allocating while moving fails.
+struct fragile
+{
+    int value;
+
+    fragile() = default;
+    fragile(fragile&&) { throw std::runtime_error("fragile"); }
+
+    LIGHTRAY_REFL_TYPE(namespace(::), fragile, (),
+        (var, value, ())
+    )
+
+}; // struct fragile
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_structural_changes)
+    {
+        ecs::registry r;
+        const auto a = r.create(position{1, 2}, velocity{1, 1});
+        const auto b = r.create(position{3, 4});
+        const auto c = r.create(label{"c"}, position{5, 6});
+
+        assert_true(r.size() == 3, "");
+        assert_true(r.has<velocity>(a) && !r.has<velocity>(b), "");
+        assert_true(r.get<label>(c).text == "c", "");
+
+        r.emplace(b, label{std::string(100, 'b')});
+        r.emplace(b, velocity{2, 2});
+        assert_true(r.get<position>(b).x == 3 && r.get<label>(b).text.size() == 100, "components must move with the entity");
+
+        r.remove<position>(a);
+        assert_true(!r.has<position>(a) && r.get<velocity>(a).dx == 1, "");
+
+        r.destroy(c);
+        assert_true(!r.alive(c) && r.size() == 2, "");
+
+        const auto d = r.create(position{7, 8});
+        assert_true(d.index == c.index && d != c, "indices must be recycled with a new generation");
+
+        bool thrown = false;
+        try
+        {
+            r.get<position>(c);
+        }
+        catch (const std::out_of_range&)
+        {
+            thrown = true;
+        }
+        assert_true(thrown, "");
+    };
+
+    lr_test_case(tests, test_create_rollback)
+    {
+        {
+            ecs::registry r;
+            const auto a = r.create(tracked{1});
+            r.create(tracked{2});
+            r.destroy(a);
+
+            bool thrown = false;
+            try
+            {
+                r.create(tracked{3}, fragile{});
+            }
+            catch (const std::runtime_error&)
+            {
+                thrown = true;
+            }
+            assert_true(thrown, "");
+            assert_true(tracked::alive == 1, "the components built before the throw must be destroyed");
+            assert_true(r.size() == 1 && (r.view<tracked, fragile>().size() == 0), "no row may be left for the entity");
+
+            const auto c = r.create(tracked{4});
+            assert_true(c.index == a.index && c != a, "the recycled index must be returned to the free list");
+            assert_true(r.size() == 2 && r.view<tracked>().size() == 2, "");
+        }
+        assert_true(tracked::alive == 0, "");
+    };
+
+    lr_test_case(tests, test_views)
+    {
+        ecs::registry r;
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto e = r.create(position{float(i), 0});
+            if (i % 2 == 0)
+                r.emplace(e, velocity{1, 2});
+            if (i % 3 == 0)
+                r.emplace(e, label{"x"});
+        }
+
+        auto moving = r.view<position, velocity>();
+        assert_true(moving.size() == 500, "");
+
+        moving.for_each([](position& p, const velocity& v) {
+            p.x += v.dx;
+            p.y += v.dy;
+        });
+
+        float sum = 0;
+        std::size_t chunks = 0;
+        r.view<position>().for_each_chunk([&](std::span<const ecs::entity> entities, std::span<position> ps) {
+            ++chunks;
+            assert_true(entities.size() == ps.size(), "");
+            for (const auto& p : ps)
+                sum += p.y;
+        });
+        assert_true(sum == 1000.0f, "");
+        assert_true(chunks == 4, "one chunk per archetype");
+
+        mtp::work_stealing_executor executor(3);
+        std::atomic<std::size_t> visited = 0;
+        r.view<position, velocity>().parallel_for_each<16>(executor, [&](ecs::entity, position& p, velocity&) {
+            p.y = 0;
+            ++visited;
+        });
+        assert_true(visited == 500, "every entity must be visited exactly once");
+
+        sum = 0;
+        r.view<position>().for_each([&](const position& p) { sum += p.y; });
+        assert_true(sum == 0.0f, "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
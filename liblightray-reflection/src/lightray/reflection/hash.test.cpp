@@ -0,0 +1,168 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/hash.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct packed_key
+{
+    std::uint32_t id;
+    std::uint16_t shard;
+    std::uint16_t kind;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), packed_key, (),
+        (var, id, ())
+        (var, shard, ())
+        (var, kind, ())
+    )
+
+}; // struct packed_key
+
+struct padded_key
+{
+    std::uint8_t tag;
+    std::uint64_t value;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), padded_key, (),
+        (var, tag, ())
+        (var, value, ())
+    )
+
+}; // struct padded_key
+
+struct cached_key
+{
+    std::uint32_t id;
+    std::uint32_t cached_lookups; // not reflected, must not affect the hash
+
+    LIGHTRAY_REFL_TYPE(namespace(::), cached_key, (),
+        (var, id, ())
+    )
+
+}; // struct cached_key
+
+struct record
+{
+    packed_key key;
+    std::string name;
+    std::vector<int> values;
+    double weight;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), record, (),
+        (var, key, ())
+        (var, name, ())
+        (var, values, ())
+        (var, weight, ())
+    )
+
+}; // struct record
+
+static_assert( is_padding_free_v<packed_key>);
+static_assert(!is_padding_free_v<padded_key>);
+static_assert(!is_padding_free_v<cached_key>);
+static_assert(!is_padding_free_v<record>);
+
+static_assert( is_bytewise_v<packed_key>);
+static_assert(!is_bytewise_v<padded_key>);
+static_assert(!is_bytewise_v<cached_key>);
+static_assert(!is_bytewise_v<record>);
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_equal_values_equal_hashes)
+    {
+        const hash<record> hasher;
+
+        record a = {{1, 2, 3}, "first", {1, 2, 3}, 0.5};
+        record b = a;
+        assert_true(hasher(a) == hasher(b), "copies must hash equally");
+
+        b.values.push_back(4);
+        assert_true(hasher(a) != hasher(b), "nested range change must change the hash");
+
+        b = a;
+        b.key.kind = 4;
+        assert_true(hasher(a) != hasher(b), "nested reflected change must change the hash");
+
+        cached_key c = {42, 0}, d = {42, 1000};
+        assert_true(hash<cached_key>{}(c) == hash<cached_key>{}(d), "unreflected members must be ignored");
+
+        padded_key e, f;
+        std::memset(&e, 0x00, sizeof(e));
+        std::memset(&f, 0xff, sizeof(f));
+        e.tag = f.tag = 7;
+        e.value = f.value = 11;
+        assert_true(hash<padded_key>{}(e) == hash<padded_key>{}(f), "padding must be ignored");
+    };
+
+    lr_test_case(tests, test_collision_quality)
+    {
+        // Sequential keys are the worst case for weak mixers: every key differs in few low bits.
+        constexpr std::size_t count = 1 << 18;
+        constexpr std::size_t bucket_count = 1 << 10;
+
+        const hash<packed_key> hasher;
+        std::unordered_set<std::size_t> seen;
+        std::array<std::size_t, bucket_count> low_buckets{};
+        std::array<std::size_t, bucket_count> high_buckets{};
+        seen.reserve(count);
+
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const auto h = hasher(packed_key{i, static_cast<std::uint16_t>(i & 3), 0});
+            seen.insert(h);
+            ++low_buckets[h % bucket_count];
+            ++high_buckets[h >> (sizeof(std::size_t) * 8 - 10)];
+        }
+        assert_true(seen.size() == count, "sequential keys must not collide");
+
+        // chi-squared over 1023 degrees of freedom; 1200 is far in the tail of a uniform distribution.
+        const auto chi_squared = [](const auto& buckets)
+        {
+            const double expected = static_cast<double>(count) / bucket_count;
+            double sum = 0;
+            for (auto n : buckets) sum += (n - expected) * (n - expected) / expected;
+            return sum;
+        };
+        assert_true(chi_squared(low_buckets) < 1200, "low bits must be uniformly distributed");
+        assert_true(chi_squared(high_buckets) < 1200, "high bits must be uniformly distributed");
+    };
+
+    lr_test_case(tests, test_as_unordered_map_hasher)
+    {
+        std::unordered_map<record, int, hash<record>, decltype([](const record& a, const record& b) {
+            return a.key.id == b.key.id && a.name == b.name && a.values == b.values && a.weight == b.weight;
+        })> map;
+
+        map[{{1, 0, 0}, "a", {}, 1.0}] = 1;
+        map[{{2, 0, 0}, "b", {1}, 2.0}] = 2;
+
+        assert_true(map.size() == 2, "");
+        assert_true(map.at({{2, 0, 0}, "b", {1}, 2.0}) == 2, "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
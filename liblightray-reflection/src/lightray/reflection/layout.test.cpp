@@ -0,0 +1,133 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <sstream>
+#include <string>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/layout.hpp>
+#include <lightray/reflection/layout_report.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct sparse
+{
+    std::uint8_t a;
+    // 7 bytes of padding
+    double b;
+    std::uint16_t c;
+    // 2 bytes of padding
+    std::uint32_t d;
+    std::uint8_t e;
+    // 7 bytes of padding
+
+    LIGHTRAY_REFL_TYPE(namespace(::), sparse, (),
+        (var, a, ())
+        (var, b, ())
+        (var, c, ())
+        (var, d, ())
+        (var, e, ())
+    )
+
+}; // struct sparse
+
+struct dense
+{
+    std::uint32_t x;
+    std::uint16_t y;
+    std::uint16_t z;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), dense, (),
+        (var, x, ())
+        (var, y, ())
+        (var, z, ())
+    )
+
+}; // struct dense
+
+// Not standard-layout, as its members have different access, but trivially copyable, so it has no virtual bases.
+class guarded
+{
+    std::uint16_t _id;
+
+public:
+    double value;
+    static inline int count = 0;
+    std::uint8_t flags;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), guarded, (),
+        (var, _id, ())
+        (var, value, ())
+        (var, count, ())
+        (var, flags, ())
+    )
+
+}; // class guarded
+
+// Not trivially copyable, so only __builtin_offsetof can take its offsets.
+struct named
+{
+    std::uint32_t id;
+    std::string name;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), named, (),
+        (var, id, ())
+        (var, name, ())
+    )
+
+}; // struct named
+
+static_assert(member_offsets<sparse> == std::array<std::ptrdiff_t, 5>{0, 8, 16, 20, 24});
+static_assert(member_offsets<guarded> == std::array<std::ptrdiff_t, 3>{0, 8, 16});
+static_assert(member_offsets<named>[1] == offsetof(named, name));
+
+using sparse_layout = layout_info<sparse>;
+
+static_assert(sparse_layout::size == 32);
+static_assert(sparse_layout::alignment == 8);
+static_assert(sparse_layout::members[0].padding == 7);
+static_assert(sparse_layout::members[1].offset == 8);
+static_assert(sparse_layout::members[2].padding == 2);
+static_assert(sparse_layout::members[4].name == "e");
+static_assert(padding_bytes<sparse> == 16);
+static_assert(padding_bytes<dense> == 0);
+
+// b, d, c, a, e
+static_assert(sparse_layout::optimal_order[0] == 1);
+static_assert(sparse_layout::optimal_order[1] == 3);
+static_assert(sparse_layout::optimal_order[2] == 2);
+static_assert(sparse_layout::optimal_order[3] == 0);
+static_assert(sparse_layout::optimal_order[4] == 4);
+static_assert(sparse_layout::optimal_size == 16);
+static_assert(layout_info<dense>::optimal_size == sizeof(dense));
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_report)
+    {
+        std::ostringstream os;
+        const auto savings = write_layout_report<sparse, dense>(os);
+        assert_true(savings == 16, "");
+
+        const auto report = os.str();
+        assert_true(report.find("sparse") != std::string::npos, "");
+        assert_true(report.find("padding 16, optimal size 16") != std::string::npos, "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
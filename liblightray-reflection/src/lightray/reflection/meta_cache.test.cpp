@@ -0,0 +1,71 @@
+#include <exception>
+#include <string_view>
+#include <type_traits>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/meta_cache.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct particle
+{
+    float x;
+    static inline int count = 0;
+    float y;
+
+    auto speed() const -> float { return x + y; }
+
+    LIGHTRAY_REFL_TYPE(namespace(::), particle, (),
+        (var, x, ())
+        (var, count, ())
+        (var, y, ())
+        (func, speed, ())
+    )
+
+}; // struct particle
+
+using cache = meta_cache<particle>;
+
+static_assert(cache::member_count == 4);
+static_assert(cache::member_names[1] == "count" && cache::member_names[3] == "speed");
+static_assert(cache::member_categories[2] == meta_category::variable);
+static_assert(cache::member_categories[3] == meta_category::function);
+
+static_assert(cache::data_member_indices.size() == 2);
+static_assert(cache::data_member_indices[0] == 0 && cache::data_member_indices[1] == 2);
+static_assert(cache::other_member_indices[0] == 1 && cache::other_member_indices[1] == 3);
+static_assert(std::is_same_v<decltype(cache::data_members), decltype(type_info_<particle>.data_members()) const>);
+
+static_assert(cache::index_of("y") == 2);
+static_assert(cache::index_of("z") == cache::member_count);
+static_assert(cache::data_index_of("y") == 1);
+static_assert(cache::data_index_of("count") == cache::data_members.size());
+
+static_assert(cache::member<"speed">().index() == 3);
+static_assert(cache::data_member<"y">().index() == 2);
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_cached_members)
+    {
+        particle p{1.0f, 2.0f};
+        assert_true(cache::data_member<"y">().invoke(p) == 2.0f, "");
+        assert_true(cache::member<"speed">().invoke(p) == 3.0f, "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
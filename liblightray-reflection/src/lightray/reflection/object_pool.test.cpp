@@ -0,0 +1,187 @@
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/dyn.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/object_pool.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct header
+{
+    int version = 3;
+    std::string topic;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), header, (),
+        (var, version, ())
+        (var, topic, ())
+    )
+
+}; // struct header
+
+struct message
+{
+    header head;
+    std::vector<double> payload;
+    std::vector<std::string> tags = {"default"};
+    long sequence = -1;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), message, (),
+        (var, head, ())
+        (var, payload, ())
+        (var, tags, ())
+        (var, sequence, ())
+    )
+
+}; // struct message
+
+struct order
+{
+    std::vector<int> quantities;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), order, (),
+        (var, quantities, ())
+    )
+
+}; // struct order
+
+struct sized_prototype
+{
+    int size() const;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), sized_prototype, (),
+        (func, size, (id_accessor, interface_proxy((int)()(const))))
+    )
+
+}; // struct sized_prototype
+
+struct batch
+{
+    std::vector<int> items;
+
+    int size() const { return static_cast<int>(items.size()); }
+
+    LIGHTRAY_REFL_TYPE(namespace(::), batch, (),
+        (var, items, ())
+    )
+
+}; // struct batch
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_reset)
+    {
+        message m;
+        m.head = {7, "prices"};
+        m.payload.assign(1000, 1.5);
+        m.tags = {"a", "b"};
+        m.sequence = 42;
+
+        const auto* storage = m.payload.data();
+        reset(m);
+
+        assert_true(m.head.version == 3 && m.head.topic.empty(), "");
+        assert_true(m.payload.empty() && m.payload.capacity() >= 1000, "containers must keep their capacity");
+        assert_true(m.payload.data() == storage, "");
+        assert_true(m.tags == std::vector<std::string>{"default"}, "default member initializers must be restored");
+        assert_true(m.sequence == -1, "");
+    };
+
+    lr_test_case(tests, test_recycle)
+    {
+        const message* first;
+        {
+            auto m = object_pool<message>::acquire();
+            m->payload.assign(500, 2.0);
+            m->sequence = 1;
+            first = m.get();
+        }
+
+        auto m = object_pool<message>::acquire();
+        assert_true(m.get() == first, "released objects must be reused");
+        assert_true(m->payload.empty() && m->payload.capacity() >= 500, "");
+        assert_true(m->sequence == -1, "");
+
+        const auto stats = object_pool<message>::statistics();
+        assert_true(stats.hits == 1 && stats.misses == 1, "");
+    };
+
+    lr_test_case(tests, test_cross_thread)
+    {
+        constexpr std::size_t count = 10 * object_pool<order>::magazine_size;
+
+        std::vector<object_pool<order>::handle> orders;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            orders.push_back(object_pool<order>::acquire());
+            orders.back()->quantities.assign(16, static_cast<int>(i));
+        }
+
+        // Released on another thread, whose magazines go to the depot when it exits.
+        std::thread([&] { orders.clear(); }).join();
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+            threads.emplace_back([] {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    auto o = object_pool<order>::acquire();
+                    if (!o->quantities.empty())
+                        throw std::logic_error("object was not reset");
+                    o->quantities.push_back(1);
+                }
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        const auto stats = object_pool<order>::statistics();
+        assert_true(stats.hits + stats.misses == 5 * count, "");
+        assert_true(stats.misses == count, "objects released by other threads must be reused");
+        assert_true(object_pool<order>::trim() > 0, "");
+    };
+
+    lr_test_case(tests, test_behind_dyn)
+    {
+        const batch* first;
+        {
+            auto b = object_pool<batch>::acquire();
+            b->items = {1, 2, 3};
+            first = b.get();
+
+            dyn<sized_prototype> d(std::move(b));
+            assert_true(d.size() == 3, "");
+        }
+
+        auto b = object_pool<batch>::acquire();
+        assert_true(b.get() == first && b->items.empty(), "a dyn must return its object to the pool");
+
+        b->items = {4, 5};
+        dyn<sized_prototype, true> a(std::move(b));
+
+        const auto before = object_pool<batch>::statistics();
+        dyn<sized_prototype, true> copy = a;
+        const auto after = object_pool<batch>::statistics();
+        assert_true(copy.size() == 2, "");
+        assert_true(after.hits + after.misses == before.hits + before.misses + 1, "copies must be acquired from the pool they are released to");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
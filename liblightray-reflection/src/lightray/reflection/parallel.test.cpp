@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/metaprogramming/work_stealing_executor.hpp>
+#include <lightray/reflection/cost_hint.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/type_info.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct simulation_state
+{
+    std::vector<double> temperatures;
+    std::vector<double> pressures;
+    std::vector<double> velocities;
+    int step;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), simulation_state, (),
+        (var, temperatures, ())
+        (var, pressures, (attributes(cost_hint{10})))
+        (var, velocities, (attributes(cost_hint{100})))
+        (var, step, ())
+    )
+
+}; // struct simulation_state
+
+// Waits until count threads have arrived, or for at most a few seconds, and returns whether they all did.
+struct rendezvous
+{
+    std::mutex mutex;
+    std::condition_variable all_arrived;
+    std::size_t arrived = 0;
+    std::size_t count;
+
+    explicit rendezvous(std::size_t count) noexcept : count(count) {}
+
+    auto arrive_and_wait() -> bool
+    {
+        std::unique_lock lock(mutex);
+        if (++arrived == count)
+            all_arrived.notify_all();
+        return all_arrived.wait_for(lock, std::chrono::seconds(5), [&] { return arrived == count; });
+    }
+
+}; // struct rendezvous
+
+constexpr auto ordered = by_cost_hint(type_info_<simulation_state>.data_members());
+static_assert(ordered.get<0>().index() == 2);
+static_assert(ordered.get<1>().index() == 1);
+static_assert(ordered.get<2>().index() == 0);
+static_assert(ordered.get<3>().index() == 3);
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_parallel_for_each_members)
+    {
+        simulation_state state{
+            std::vector<double>(100000, 1.0),
+            std::vector<double>(100000, 2.0),
+            std::vector<double>(100000, 3.0),
+            0
+        };
+
+        mtp::work_stealing_executor executor(3);
+        std::mutex mutex;
+        std::vector<std::thread::id> threads;
+        std::atomic<int> visited = 0;
+        std::atomic<int> overlapped = 0;
+        rendezvous all_running(4);
+
+        // 3 workers and the calling thread, so that every member is processed at the same time.
+        ordered.parallel_for_each(executor, [&]<auto Member>{
+            overlapped += all_running.arrive_and_wait();
+
+            auto& member = Member.invoke(state);
+            if constexpr (requires { member.begin(); })
+                for (auto& x : member)
+                    x *= 2;
+            else
+                member += 1;
+
+            ++visited;
+            std::lock_guard lock(mutex);
+            threads.push_back(std::this_thread::get_id());
+        });
+
+        assert_true(visited == 4, "");
+        assert_true(state.step == 1, "");
+        assert_true(std::accumulate(state.velocities.begin(), state.velocities.end(), 0.0) == 600000.0, "");
+        assert_true(threads.size() == 4, "");
+        assert_true(overlapped == 4, "the members must be processed concurrently");
+    };
+
+    lr_test_case(tests, test_given_order)
+    {
+        // The worker runs the tasks it takes from its own queue in the order they are given,
+        // while the calling thread steals from the other end.
+        mtp::work_stealing_executor executor(1);
+        const auto caller = std::this_thread::get_id();
+        std::mutex mutex;
+        std::vector<std::size_t> worker_order;
+
+        mtp::make_index_sequence<16>.parallel_for_each(executor, [&]<std::size_t I>{
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            std::lock_guard lock(mutex);
+            if (std::this_thread::get_id() != caller)
+                worker_order.push_back(I);
+        });
+
+        assert_true(std::is_sorted(worker_order.begin(), worker_order.end()), "the worker must run its tasks in given order");
+    };
+
+    lr_test_case(tests, test_nested_and_exceptions)
+    {
+        mtp::work_stealing_executor executor(2);
+        std::atomic<int> count = 0;
+
+        mtp::make_index_sequence<4>.parallel_for_each(executor, [&]<std::size_t I>{
+            mtp::make_index_sequence<8>.parallel_for_each(executor, [&]<std::size_t J>{ ++count; });
+        });
+        assert_true(count == 32, "nested execute must not deadlock");
+
+        bool thrown = false;
+        try
+        {
+            executor.execute([]{}, []{ throw std::runtime_error("task"); }, []{});
+        }
+        catch (const std::runtime_error&)
+        {
+            thrown = true;
+        }
+        assert_true(thrown, "exceptions must propagate to the caller");
+
+        mtp::inline_executor inline_ex;
+        int order = 0;
+        mtp::make_index_sequence<3>.parallel_for_each(inline_ex, [&]<std::size_t I>{ order = order * 10 + I + 1; });
+        assert_true(order == 123, "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
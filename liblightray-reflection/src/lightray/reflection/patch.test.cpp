@@ -0,0 +1,202 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/compare.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/patch.hpp>
+#include <lightray/reflection/serialize.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct vec3
+{
+    float x, y, z;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), vec3, (),
+        (var, x, ())
+        (var, y, ())
+        (var, z, ())
+    )
+
+}; // struct vec3
+
+struct body
+{
+    vec3 position;
+    vec3 velocity;
+    std::uint32_t flags;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), body, (),
+        (var, position, ())
+        (var, velocity, ())
+        (var, flags, ())
+    )
+
+}; // struct body
+
+struct world_state
+{
+    std::uint64_t tick;
+    std::string name;
+    std::vector<body> bodies;
+    std::array<std::int32_t, 64> scores;
+    body player;
+    body camera;
+
+    void reset();
+
+    LIGHTRAY_REFL_TYPE(namespace(::), world_state, (),
+        (var, tick, ())
+        (var, name, ())
+        (var, bodies, ())
+        (var, scores, ())
+        (func, reset, ())
+        (var, player, ())
+        (var, camera, ())
+    )
+
+}; // struct world_state
+
+// Trivially copyable, but its name points elsewhere, so it must not be written as is.
+struct name_ref
+{
+    std::uint32_t id;
+    std::string_view name;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), name_ref, (),
+        (var, id, ())
+        (var, name, ())
+    )
+
+}; // struct name_ref
+
+struct name_copy
+{
+    std::uint32_t id;
+    std::string name;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), name_copy, (),
+        (var, id, ())
+        (var, name, ())
+    )
+
+}; // struct name_copy
+
+static_assert(!detail::serialize_raw<std::string_view>);
+static_assert(!detail::serialize_raw<name_ref>);
+static_assert(detail::serialize_raw<std::array<std::int32_t, 4>>);
+static_assert(serializable_v<name_ref>);
+static_assert(serializable_v<std::span<const std::byte>>);
+static_assert(!serializable_v<std::span<const std::int32_t>>, "cannot be viewed in unaligned input");
+static_assert(!serializable_v<const int*>);
+
+static auto make_state() -> world_state
+{
+    world_state state{};
+    state.tick = 100;
+    state.name = "world";
+    state.bodies.resize(256);
+    for (std::size_t i = 0; i < state.bodies.size(); ++i)
+        state.bodies[i].position.x = static_cast<float>(i);
+    state.player.velocity = {1, 2, 3};
+    return state;
+}
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_serialize_roundtrip)
+    {
+        const auto state = make_state();
+        const auto bytes = serialize(state);
+
+        world_state copy;
+        std::span<const std::byte> in = bytes;
+        deserialize(in, copy);
+
+        assert_true(in.empty(), "");
+        assert_true(equal(state, copy), "");
+
+        std::span<const std::byte> truncated = std::span{bytes}.first(bytes.size() - 1);
+        bool thrown = false;
+        try { deserialize(truncated, copy); } catch (const deserialize_error&) { thrown = true; }
+        assert_true(thrown, "truncated input must be rejected");
+    };
+
+    lr_test_case(tests, test_serialize_view)
+    {
+        const std::string text = "hello";
+        const name_ref ref{7, text};
+        const auto bytes = serialize(ref);
+
+        assert_true(bytes == serialize(name_copy{7, text}), "a view must be written as the bytes it views");
+
+        name_ref copy{};
+        std::span<const std::byte> in = bytes;
+        deserialize(in, copy);
+
+        assert_true(in.empty(), "");
+        assert_true(copy.id == 7 && copy.name == "hello", "");
+        assert_true(
+            static_cast<const void*>(copy.name.data()) == static_cast<const void*>(bytes.data() + bytes.size() - 5),
+            "a view must be read back as a view into the input"
+        );
+
+        std::span<const std::byte> truncated = std::span{bytes}.first(bytes.size() - 1);
+        bool thrown = false;
+        try { deserialize(truncated, copy); } catch (const deserialize_error&) { thrown = true; }
+        assert_true(thrown, "truncated input must be rejected");
+    };
+
+    lr_test_case(tests, test_diff_apply)
+    {
+        const auto old_state = make_state();
+        auto new_state = old_state;
+
+        assert_true(diff(old_state, new_state).empty(), "equal values must give an empty patch");
+
+        new_state.tick += 1;
+        new_state.player.position.y = 42;
+        new_state.camera.flags = 7;
+
+        const auto p = diff(old_state, new_state);
+        assert_true(p.changed(type_info_<world_state>.members().get<0>().index()), "tick");
+        assert_true(!p.changed(type_info_<world_state>.members().get<2>().index()), "bodies");
+        assert_true(p.changed(type_info_<world_state>.members().get<5>().index()), "player");
+
+        auto replica = old_state;
+        apply_patch(replica, p);
+        assert_true(equal(replica, new_state), "patched replica must equal the new state");
+
+        // 3 changed fields out of a ~7KB state.
+        const auto full_size = serialize(new_state).size();
+        assert_true(p.size() * 100 < full_size, "patch must be much smaller than a snapshot");
+
+        auto bad = p;
+        bad.bytes.push_back(std::byte{0});
+        bool thrown = false;
+        try { apply_patch(replica, bad); } catch (const deserialize_error&) { thrown = true; }
+        assert_true(thrown, "trailing bytes must be rejected");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
@@ -0,0 +1,223 @@
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <unistd.h>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/columnar.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/query.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+enum class side : std::uint8_t { buy, sell };
+
+struct trade
+{
+    std::uint32_t symbol;
+    side direction;
+    double price;
+    std::int32_t quantity;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), trade, (),
+        (var, symbol, ())
+        (var, direction, ())
+        (var, price, ())
+        (var, quantity, ())
+    )
+
+}; // struct trade
+
+struct tally
+{
+    std::int32_t n;
+    std::int32_t total;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), tally, (),
+        (var, n, ())
+        (var, total, ())
+    )
+
+}; // struct tally
+
+// The columns of a range of tallies, as a column source.
+struct tally_columns
+{
+    std::vector<std::int32_t> n;
+    std::vector<std::int32_t> total;
+
+    auto size() const noexcept -> std::size_t { return n.size(); }
+
+    template <mtp::fixed_string Name>
+    auto column() const -> const std::vector<std::int32_t>&
+    {
+        if constexpr (Name == mtp::fixed_string{"n"})
+            return n;
+        else
+            return total;
+    }
+
+}; // struct tally_columns
+
+static auto make_trades() -> std::vector<trade>
+{
+    std::vector<trade> trades;
+    for (std::uint32_t i = 0; i < 1000; ++i)
+        trades.push_back({i % 4, i % 2 ? side::sell : side::buy, 50.0 + i % 100, static_cast<std::int32_t>(i % 10)});
+    return trades;
+}
+
+static const auto path = std::filesystem::temp_directory_path() / ("lightray_query_" + std::to_string(::getpid()));
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_filter_and_count)
+    {
+        using namespace refl::q;
+        const auto trades = make_trades();
+
+        const auto pred = field<"price"> > 140.0 && field<"direction"> == side::buy;
+        std::size_t expected = 0;
+        for (const auto& t : trades)
+            expected += t.price > 140.0 && t.direction == side::buy;
+
+        assert_true(q::count(trades, pred) == expected, "count");
+        assert_true(q::filter(trades, pred).size() == expected, "filter");
+        assert_true(q::count(trades, !pred) == trades.size() - expected, "negation");
+        assert_true(q::count(trades, always) == trades.size(), "always");
+        assert_true(q::count(trades, field<"quantity"> * 2 + 1 == 19) == 100, "arithmetic");
+    };
+
+    lr_test_case(tests, test_aggregate)
+    {
+        using namespace refl::q;
+        const auto trades = make_trades();
+
+        const auto [volume, low, high, n] = aggregate(
+            trades, field<"symbol"> == 1u,
+            sum(field<"price"> * field<"quantity">), q::min(field<"price">), q::max(field<"price">), q::count()
+        );
+
+        double expected = 0;
+        for (const auto& t : trades)
+            if (t.symbol == 1)
+                expected += t.price * t.quantity;
+
+        assert_true(volume == expected, "sum");
+        assert_true(low == 51.0 && high == 147.0, "min/max");
+        assert_true(n == 250, "count");
+
+        const auto none = aggregate(trades, field<"price"> < 0.0, q::min(field<"price">));
+        static_assert(std::is_same_v<decltype(none), const std::optional<double>>);
+        assert_true(!none, "empty min");
+    };
+
+    lr_test_case(tests, test_guarded_division)
+    {
+        using namespace refl::q;
+
+        std::vector<tally> tallies;
+        tally_columns columns;
+        for (std::int32_t i = 0; i < 100; ++i)
+        {
+            tallies.push_back({i % 4, i});
+            columns.n.push_back(i % 4);
+            columns.total.push_back(i);
+        }
+
+        std::size_t expected = 0;
+        std::int32_t expected_sum = 0;
+        for (const auto& t : tallies)
+            if (t.n != 0)
+            {
+                expected += t.total / t.n > 4;
+                expected_sum += t.total / t.n;
+            }
+
+        const auto guarded = field<"n"> != 0 && field<"total"> / field<"n"> > 4;
+        assert_true(q::count(tallies, guarded) == expected, "&& must not divide by zero");
+        assert_true(q::count(columns, guarded) == expected, "");
+
+        const auto unguarded = field<"n"> == 0 || field<"total"> / field<"n"> <= 4;
+        assert_true(q::count(tallies, unguarded) == tallies.size() - expected, "|| must not divide by zero");
+        assert_true(q::count(columns, unguarded) == tallies.size() - expected, "");
+
+        assert_true(aggregate(tallies, field<"n"> != 0, sum(field<"total"> / field<"n">)) == expected_sum, "aggregates must skip rejected records");
+        assert_true(aggregate(columns, field<"n"> != 0, sum(field<"total"> / field<"n">)) == expected_sum, "");
+    };
+
+    lr_test_case(tests, test_project_and_group_by)
+    {
+        using namespace refl::q;
+        const auto trades = make_trades();
+
+        const auto rows = project(trades, field<"quantity"> == 9, field<"symbol">, field<"price"> * 2.0);
+        static_assert(std::is_same_v<decltype(rows)::value_type, std::tuple<std::uint32_t, double>>);
+        assert_true(rows.size() == 100, "");
+        assert_true(std::get<0>(rows[0]) == 1 && std::get<1>(rows[0]) == 118.0, "");
+
+        const auto groups = group_by(trades, field<"direction"> == side::sell, field<"symbol">, q::count(), sum(field<"quantity">));
+        assert_true(groups.size() == 2, "only odd symbols sell");
+        assert_true(std::get<0>(groups.at(1)) == 250 && std::get<0>(groups.at(3)) == 250, "");
+        assert_true(std::get<1>(groups.at(1)) == 1250, "");
+    };
+
+    lr_test_case(tests, test_columns)
+    {
+        using namespace refl::q;
+        const auto trades = make_trades();
+        {
+            columnar::writer<trade> w(path);
+            for (const auto& t : trades)
+                w.push_back(t);
+        }
+
+        {
+            columnar::reader<trade> r(path);
+            const auto pred = field<"price"> >= 120.0 || field<"quantity"> < 2;
+            assert_true(q::count(r, pred) == q::count(trades, pred), "");
+
+            const auto from_columns = aggregate(r, pred, sum(field<"price">), q::max(field<"quantity">));
+            const auto from_records = aggregate(trades, pred, sum(field<"price">), q::max(field<"quantity">));
+            assert_true(from_columns == from_records, "");
+        }
+        std::filesystem::remove(path);
+    };
+
+    lr_test_case(tests, test_field_named)
+    {
+        using namespace refl::q;
+        const auto trades = make_trades();
+
+        const auto price = field_named<trade>("price");
+        assert_true(q::count(trades, price > 140.0) == q::count(trades, field<"price"> > 140.0), "");
+        assert_true(aggregate(trades, always, sum(field_named<trade>("quantity"))) == 4500.0, "");
+
+        bool thrown = false;
+        try { (void)field_named<trade>("volume"); }
+        catch (const std::invalid_argument&) { thrown = true; }
+        assert_true(thrown, "unknown member");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
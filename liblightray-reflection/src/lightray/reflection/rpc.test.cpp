@@ -0,0 +1,198 @@
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/dyn.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/rpc.hpp>
+#include <lightray/reflection/rpc_unix_socket.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct store_prototype
+{
+    void put(std::string key, int value);
+    int get(const std::string& key) const;
+    int size() const;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), store_prototype, (),
+        (func, put, (id_accessor, interface_proxy(
+            (void)((std::string)(key), (int)(value))(),
+            (void)((std::vector<std::string>)(keys), (int)(value))()
+        )))
+        (func, get, (id_accessor, interface_proxy((int)((const std::string&)(key))(const))))
+        (func, size, (id_accessor, interface_proxy((int)()(const))))
+    )
+
+}; // struct store_prototype
+
+static_assert(rpc::method_count<store_prototype> == 4);
+
+struct store
+{
+    std::vector<std::pair<std::string, int>> entries;
+
+    void put(std::string key, int value) { entries.emplace_back(std::move(key), value); }
+
+    void put(std::vector<std::string> keys, int value)
+    {
+        for (auto& key : keys)
+            put(std::move(key), value);
+    }
+
+    int get(const std::string& key) const
+    {
+        for (const auto& [k, v] : entries)
+            if (k == key)
+                return v;
+        throw std::out_of_range("no such key: " + key);
+    }
+
+    int size() const { return static_cast<int>(entries.size()); }
+
+}; // struct store
+
+// Throws something which is not a std::exception.
+struct faulty_store : store
+{
+    int size() const { throw 42; }
+
+}; // struct faulty_store
+
+template <typename Store>
+auto exercise(Store& remote) -> void
+{
+    remote.put("a", 1);
+    remote.put(std::vector<std::string>{"b", "c"}, 2);
+
+    assert_true(remote.size() == 3, "");
+    assert_true(remote.get("a") == 1, "");
+    assert_true(remote.get("c") == 2, "");
+
+    bool thrown = false;
+    try
+    {
+        remote.get("d");
+    }
+    catch (const rpc::remote_error& e)
+    {
+        thrown = std::string(e.what()) == "no such key: d";
+    }
+    assert_true(thrown, "exceptions must be reported to the caller");
+}
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_queue_transport)
+    {
+        store impl;
+        auto server = rpc::make_server<store_prototype>(impl);
+
+        rpc::queue_transport transport;
+        std::thread serving([&] { transport.serve(server); });
+
+        rpc::client<store_prototype, rpc::queue_transport> remote(transport);
+        exercise(remote);
+
+        transport.close();
+        serving.join();
+        assert_true(impl.entries.size() == 3, "");
+    };
+
+    lr_test_case(tests, test_client_behind_dyn)
+    {
+        dyn<store_prototype> local(std::make_unique<store>());
+        rpc::server<store_prototype> server(local);
+
+        rpc::queue_transport transport;
+        std::thread serving([&] { transport.serve(server); });
+
+        dyn<store_prototype> remote(std::make_unique<rpc::client<store_prototype, rpc::queue_transport>>(transport));
+        exercise(remote);
+        assert_true(local.size() == 3, "");
+
+        transport.close();
+        serving.join();
+    };
+
+    lr_test_case(tests, test_unix_socket_transport)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "lightray_rpc_test.sock";
+
+        store impl;
+        auto server = rpc::make_server<store_prototype>(impl);
+
+        rpc::unix_socket_listener listener(path);
+        std::thread serving([&] { listener.accept().serve(server); });
+
+        {
+            auto transport = rpc::unix_socket_transport::connect(path);
+            rpc::client<store_prototype, rpc::unix_socket_transport> remote(transport);
+            exercise(remote);
+
+            for (int i = 0; i < 1000; ++i)
+                remote.put("x", i);
+            assert_true(remote.size() == 1003, "");
+        }
+
+        serving.join();
+    };
+
+    lr_test_case(tests, test_unix_socket_errors)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "lightray_rpc_errors_test.sock";
+
+        faulty_store impl;
+        auto server = rpc::make_server<store_prototype>(impl);
+
+        rpc::unix_socket_listener listener(path);
+        bool rejected = false;
+        std::thread serving([&] {
+            try { listener.accept(64).serve(server); } catch (const deserialize_error&) { rejected = true; }
+        });
+
+        auto transport = rpc::unix_socket_transport::connect(path);
+        rpc::client<store_prototype, rpc::unix_socket_transport> remote(transport);
+
+        bool thrown = false;
+        try { remote.size(); } catch (const rpc::remote_error& e) { thrown = std::string(e.what()).ends_with("unknown exception"); }
+        assert_true(thrown, "exceptions of any type must be reported to the caller");
+
+        std::vector<std::thread> callers;
+        for (int t = 0; t < 4; ++t)
+            callers.emplace_back([&] {
+                for (int i = 0; i < 100; ++i)
+                    remote.put("k", i);
+            });
+        for (auto& caller : callers)
+            caller.join();
+        assert_true(remote.get("k") == 0, "the server must keep serving after an exception, and calls from several threads must not interleave");
+
+        thrown = false;
+        try { remote.put(std::string(1 << 20, 'x'), 0); } catch (const rpc::remote_error& e) { thrown = std::string(e.what()).find("exceeds") != std::string::npos; }
+        assert_true(thrown, "frames larger than the maximum must be rejected");
+
+        serving.join();
+        assert_true(rejected && impl.entries.size() == 400, "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
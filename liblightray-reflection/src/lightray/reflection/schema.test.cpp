@@ -0,0 +1,152 @@
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/schema.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct vec2
+{
+    float x, y;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), vec2, (),
+        (var, x, ())
+        (var, y, ())
+    )
+
+}; // struct vec2
+
+namespace v1
+{
+    struct player
+    {
+        std::uint32_t id;
+        std::string name;
+        float health;
+        vec2 position;
+
+        LIGHTRAY_REFL_TYPE(namespace(v1), player, (),
+            (var, id, ())
+            (var, name, ())
+            (var, health, ())
+            (var, position, ())
+        )
+
+    }; // struct player
+
+} // namespace v1
+
+namespace v2
+{
+    struct player
+    {
+        std::string name;
+        double health;
+        std::uint16_t level = 1;
+        std::uint32_t id;
+        vec2 position;
+
+        LIGHTRAY_REFL_TYPE(namespace(v2), player, (),
+            (var, name, ())
+            (var, health, ())
+            (var, level, ())
+            (var, id, ())
+            (var, position, ())
+        )
+
+    }; // struct player
+
+} // namespace v2
+
+struct vec2_renamed
+{
+    float x, z;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), vec2_renamed, (),
+        (var, x, ())
+        (var, z, ())
+    )
+
+}; // struct vec2_renamed
+
+struct tree_node
+{
+    int value;
+    std::vector<tree_node> children;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), tree_node, (),
+        (var, value, ())
+        (var, children, ())
+    )
+
+}; // struct tree_node
+
+static_assert(schema_hash<vec2>() == schema_hash<vec2>());
+static_assert(schema_hash<vec2>() != schema_hash<vec2_renamed>());
+static_assert(schema_hash<v1::player>() != schema_hash<v2::player>());
+static_assert(schema_hash<tree_node>() != 0);
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_matching_schema)
+    {
+        const v1::player p{7, "alice", 42.5f, {1, 2}};
+
+        std::vector<std::byte> bytes;
+        serialize_versioned(bytes, p);
+        serialize_versioned(bytes, vec2{3, 4});
+
+        std::span<const std::byte> in = bytes;
+        v1::player q{};
+        vec2 v{};
+        assert_true(deserialize_versioned(in, q), "same schema must take the fast path");
+        assert_true(deserialize_versioned(in, v), "");
+        assert_true(in.empty(), "");
+        assert_true(q.id == 7 && q.name == "alice" && q.health == 42.5f && q.position.y == 2, "");
+        assert_true(v.x == 3 && v.y == 4, "");
+    };
+
+    lr_test_case(tests, test_evolved_schema)
+    {
+        const v1::player p{7, "alice", 42.5f, {1, 2}};
+
+        std::vector<std::byte> bytes;
+        serialize_versioned(bytes, p);
+
+        std::span<const std::byte> in = bytes;
+        v2::player q{};
+        q.health = -1;
+        assert_true(!deserialize_versioned(in, q), "changed schema must take the slow path");
+        assert_true(in.empty(), "");
+        assert_true(q.id == 7 && q.name == "alice", "fields must be mapped by name");
+        assert_true(q.position.x == 1 && q.position.y == 2, "");
+        assert_true(q.health == -1, "a field whose type changed must be skipped");
+        assert_true(q.level == 1, "a new field must keep its value");
+
+        std::span<const std::byte> truncated = std::span{bytes}.first(bytes.size() - 1);
+        bool thrown = false;
+        try { deserialize_versioned(truncated, q); } catch (const deserialize_error&) { thrown = true; }
+        assert_true(thrown, "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
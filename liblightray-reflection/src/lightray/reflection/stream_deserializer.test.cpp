@@ -0,0 +1,134 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/compare.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/serialize.hpp>
+#include <lightray/reflection/stream_deserializer.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct sample
+{
+    double time;
+    std::vector<float> values;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), sample, (),
+        (var, time, ())
+        (var, values, ())
+    )
+
+}; // struct sample
+
+struct message
+{
+    std::uint32_t id;
+    std::string topic;
+    std::vector<sample> samples;
+    std::array<std::string, 2> labels;
+    std::uint16_t checksum;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), message, (),
+        (var, id, ())
+        (var, topic, ())
+        (var, samples, ())
+        (var, labels, ())
+        (var, checksum, ())
+    )
+
+}; // struct message
+
+static_assert(stream_deserializable_v<message>);
+
+static auto make_message(std::uint32_t id) -> message
+{
+    message m{id, "sensors/temperature", {}, {"left", "a label long enough to allocate"}, 0xbeef};
+    for (int i = 0; i < 20; ++i)
+        m.samples.push_back({i * 0.5, std::vector<float>(static_cast<std::size_t>(i), static_cast<float>(i))});
+    return m;
+}
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_any_chunking)
+    {
+        const auto original = make_message(1);
+        const auto bytes = serialize(original);
+
+        for (std::size_t chunk_size : {std::size_t{1}, std::size_t{3}, std::size_t{7}, std::size_t{64}, bytes.size()})
+        {
+            message decoded;
+            stream_deserializer decoder(decoded);
+
+            for (std::size_t offset = 0; offset < bytes.size(); offset += chunk_size)
+            {
+                assert_true(!decoder.done(), "");
+                const auto chunk = std::span{bytes}.subspan(offset, std::min(chunk_size, bytes.size() - offset));
+                assert_true(decoder.feed(chunk) == chunk.size(), "");
+            }
+
+            assert_true(decoder.done(), "");
+            assert_true(equal(original, decoded), "");
+        }
+    };
+
+    lr_test_case(tests, test_back_to_back_messages)
+    {
+        auto bytes = serialize(make_message(1));
+        serialize(bytes, make_message(2));
+
+        message decoded;
+        stream_deserializer decoder(decoded);
+
+        std::span<const std::byte> in = bytes;
+        in = in.subspan(decoder.feed(in));
+        assert_true(decoder.done() && decoded.id == 1, "");
+        assert_true(!in.empty(), "the next message must be left unconsumed");
+
+        decoder.reset();
+        in = in.subspan(decoder.feed(in));
+        assert_true(decoder.done() && in.empty(), "");
+        assert_true(equal(decoded, make_message(2)), "");
+    };
+
+    lr_test_case(tests, test_bounded_growth)
+    {
+        // a sample announcing 2^40 values, of which only 3 arrive.
+        std::vector<std::byte> bytes;
+        serialize(bytes, 1.0);
+        serialize(bytes, std::uint64_t{1} << 40);
+        serialize(bytes, 1.0f);
+        serialize(bytes, 2.0f);
+        serialize(bytes, 3.0f);
+        bytes.pop_back();
+
+        sample decoded;
+        stream_deserializer decoder(decoded);
+        decoder.feed(bytes);
+
+        assert_true(!decoder.done(), "");
+        assert_true(decoded.values.size() == 3, "storage must follow the received data");
+        assert_true(decoded.values[1] == 2.0f, "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
@@ -0,0 +1,183 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/dyn.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/task.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+static std::atomic<std::size_t> allocation_count = 0;
+
+auto operator new(std::size_t size) -> void*
+{
+    ++allocation_count;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+auto operator delete(void* p) noexcept -> void
+{
+    std::free(p);
+}
+
+auto operator delete(void* p, std::size_t) noexcept -> void
+{
+    std::free(p);
+}
+
+auto leaf(int x) -> task<int>
+{
+    co_return x * 2;
+}
+
+auto chain(int depth) -> task<int>
+{
+    if (depth == 0)
+        co_return co_await leaf(1);
+    co_return 1 + co_await chain(depth - 1);
+}
+
+auto failing() -> task<int>
+{
+    throw std::runtime_error("failing");
+    co_return 0;
+}
+
+auto pooled(std::allocator_arg_t, frame_pool&, int x) -> task<int>
+{
+    co_return co_await leaf(x);
+}
+
+struct resume_on_thread
+{
+    std::thread* thread;
+
+    auto await_ready() const noexcept -> bool { return false; }
+
+    auto await_suspend(std::coroutine_handle<> handle) -> void
+    {
+        *thread = std::thread([handle] { handle.resume(); });
+    }
+
+    auto await_resume() const noexcept -> void {}
+
+}; // struct resume_on_thread
+
+auto hop(std::thread* thread) -> task<void>
+{
+    co_await resume_on_thread{thread};
+    co_await leaf(0);
+}
+
+struct cache_service
+{
+    refl::task<int> lookup(int key);
+
+    LIGHTRAY_REFL_TYPE(namespace(::), cache_service, (),
+        (func, lookup, (id_accessor, interface_proxy((refl::task<int>)((int)(key))())))
+    )
+
+}; // struct cache_service
+
+struct doubling_cache
+{
+    int hits = 0;
+
+    auto lookup(int key) -> task<int>
+    {
+        ++hits;
+        co_return co_await leaf(key);
+    }
+
+}; // struct doubling_cache
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_task_chain)
+    {
+        assert_true(sync_wait(leaf(21)) == 42, "");
+        assert_true(sync_wait(chain(10000)) == 10002, "symmetric transfer must not grow the stack");
+
+        bool thrown = false;
+        try
+        {
+            sync_wait(failing());
+        }
+        catch (const std::runtime_error&)
+        {
+            thrown = true;
+        }
+        assert_true(thrown, "exceptions must propagate to the awaiter");
+    };
+
+    lr_test_case(tests, test_frames_are_pooled)
+    {
+        sync_wait(chain(16));
+
+        const auto before = allocation_count.load();
+        for (int i = 0; i < 1000; ++i)
+            sync_wait(chain(16));
+        assert_true(allocation_count.load() == before, "frames must be reused from the thread's pool");
+
+        frame_pool pool;
+        {
+            frame_pool_scope scope(pool);
+            sync_wait(chain(4));
+        }
+        const auto scoped = allocation_count.load();
+        {
+            frame_pool_scope scope(pool);
+            sync_wait(chain(4));
+        }
+        sync_wait(pooled(std::allocator_arg, pool, 3));
+        assert_true(allocation_count.load() == scoped, "frames must be reused from the scoped pool");
+    };
+
+    lr_test_case(tests, test_task_through_dyn)
+    {
+        auto implementation = std::make_unique<doubling_cache>();
+        const auto* cache = implementation.get();
+        dyn<cache_service> service = std::move(implementation);
+        assert_true(sync_wait(service.lookup(21)) == 42, "");
+
+        const auto before = allocation_count.load();
+        for (int i = 0; i < 1000; ++i)
+            sync_wait(service.lookup(i));
+        assert_true(allocation_count.load() == before, "frames of coroutines called through dyn must be pooled");
+        assert_true(cache->hits == 1001, "");
+    };
+
+    lr_test_case(tests, test_resume_on_other_thread)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            std::thread thread;
+            sync_wait(hop(&thread));
+            thread.join();
+        }
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
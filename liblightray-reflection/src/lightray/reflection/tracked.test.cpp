@@ -0,0 +1,88 @@
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/tracked.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct widget
+{
+    int x;
+    int y;
+    std::string label;
+
+    void draw();
+
+    LIGHTRAY_REFL_TYPE(namespace(::), widget, (),
+        (var, x, (proxy))
+        (var, y, (proxy))
+        (func, draw, ())
+        (var, label, (proxy))
+    )
+
+}; // struct widget
+
+constexpr auto x_index = type_info_<widget>.members().get<0>().index();
+constexpr auto y_index = type_info_<widget>.members().get<1>().index();
+constexpr auto label_index = type_info_<widget>.members().get<3>().index();
+
+// for_each_dirty only looks at the bits of the four members.
+static_assert(refl::detail::tracked_last_word_mask<widget> == 0b1111);
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_dirty_bits)
+    {
+        tracked<widget> w{widget{1, 2, "a"}};
+        assert_true(!w.any_dirty(), "");
+
+        w.y(5).label("b");
+        assert_true(w.y() == 5 && w.get().label == "b", "");
+        assert_true(!w.is_dirty(x_index), "");
+        assert_true(w.is_dirty(y_index), "");
+        assert_true(w.is_dirty(label_index), "");
+
+        std::vector<std::size_t> visited;
+        w.for_each_dirty([&]<auto Member>{ visited.push_back(Member.index()); });
+        assert_true(visited == std::vector<std::size_t>{y_index, label_index}, "only dirty members must be visited");
+
+        w.clear_dirty();
+        assert_true(!w.any_dirty(), "");
+    };
+
+    lr_test_case(tests, test_observers)
+    {
+        int x_changes = 0;
+        std::string last_label;
+
+        tracked w{
+            widget{},
+            observe<"x">([&](int) { ++x_changes; }),
+            observe<"label">([&](const std::string& s) { last_label = s; })
+        };
+        static_assert(sizeof(tracked<widget>) < sizeof(widget) + 16);
+
+        w.x(1).x(2).y(3).label("hello");
+        assert_true(x_changes == 2, "");
+        assert_true(last_label == "hello", "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
@@ -0,0 +1,74 @@
+#include <exception>
+#include <string_view>
+
+#include <lightray/debug/assertion.hpp>
+#include <lightray/debug/print.hpp>
+#include <lightray/debug/test_case.hpp>
+
+#include <lightray/metaprogramming/fixed_string.hpp>
+
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/type_info.hpp>
+
+
+
+using namespace lightray;
+using namespace lightray::debug;
+using lightray::debug::println;
+using namespace lightray::refl;
+
+
+
+struct global_node
+{
+    int id;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), global_node, (),
+        (var, id, ())
+    )
+
+}; // struct global_node
+
+namespace game::scene
+{
+    struct node
+    {
+        struct handle
+        {
+            int index;
+
+            LIGHTRAY_REFL_TYPE(outer_class(node), handle, (),
+                (var, index, ())
+            )
+
+        }; // struct handle
+
+        handle parent;
+
+        LIGHTRAY_REFL_TYPE(namespace(::game::scene), node, (),
+            (var, parent, ())
+        )
+
+    }; // struct node
+
+} // namespace game::scene
+
+static_assert(type_info_<global_node>.qualified_name() == mtp::fixed_string("::global_node"));
+static_assert(type_info_<game::scene::node>.qualified_name() == mtp::fixed_string("::game::scene::node"));
+static_assert(type_info_<game::scene::node::handle>.qualified_name() == mtp::fixed_string("::game::scene::node::handle"));
+
+int main()
+{
+    test_case_database tests;
+
+    lr_test_case(tests, test_qualified_name)
+    {
+        // Usable as a runtime string, e.g. for logging, without being built at runtime.
+        constexpr auto name = type_info_<game::scene::node::handle>.qualified_name();
+        assert_true(std::string_view(name.c_str()) == "::game::scene::node::handle", "");
+        assert_true(name.hash() == mtp::fixed_string("::game::scene::node::handle").hash(), "");
+    };
+
+    tests.execute_all([](const std::exception& e){ println("{}", e.what()); });
+
+} // fn main
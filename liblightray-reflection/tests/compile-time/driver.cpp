@@ -0,0 +1,588 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+/*
+ * Compile-time benchmark of reflection heavy translation units.
+ *
+ * Generates synthetic translation units of:
+ *  - reflected types with 8, 64, 128 and 256 data members, looked up with and without refl::meta_cache,
+ *  - dyn prototypes with 4, 32 and 128 functions, with and without an extern vtable,
+ *  - member offsets of records with 16, 64 and 128 members,
+ *  - preprocessor seqs of 256, 1024 and 4096 elements,
+ *  - dict_tuples and indexed_dict_tuples with 16, 64 and 256 keys,
+ *  - type_pack algorithms and their naive recursive counterparts over 16, 64 and 256 types,
+ *  - type_pack and value_pack find_if over 32, 128 and 512 elements,
+ * compiles each with the given compiler command, and reports, as JSON, for each of them:
+ *  seconds:                    wall time of the compilation
+ *  peak_memory_kib:            peak resident memory of the compiler (including its subprocesses)
+ *  class_instantiations,
+ *  function_instantiations:    template instantiations, from -ftime-trace (Clang only, else null)
+ *
+ * Usage:
+ *  driver [--output <file>] [--filter <substring>] -- <compiler> [<option>...]
+ *
+ * The options must make the lightray headers visible (see the testscript). A case which
+ * fails to compile is reported with its exit status, and its diagnostics are kept in
+ * <name>.log next to the report.
+ */
+
+
+
+struct benchmark_case
+{
+    std::string name;
+    std::string kind;
+    std::size_t count;
+    std::string source;
+
+}; // struct benchmark_case
+
+struct benchmark_result
+{
+    int status;
+    double seconds;
+    long peak_memory_kib;
+    std::optional<std::size_t> class_instantiations;
+    std::optional<std::size_t> function_instantiations;
+    std::optional<std::uintmax_t> object_bytes;
+
+}; // struct benchmark_result
+
+// When cached, looks the members up through refl::meta_cache instead of find_if.
+static auto generate_record(bool cached, std::size_t members) -> std::string
+{
+    std::ostringstream os;
+    os << "#include <cstddef>\n"
+          "#include <lightray/reflection/gen_meta.hpp>\n"
+          "#include <lightray/reflection/meta_cache.hpp>\n"
+          "#include <lightray/reflection/type_info.hpp>\n\n"
+          "using namespace lightray;\n\n"
+          "struct record\n{\n";
+
+    for (std::size_t i = 0; i < members; ++i)
+        os << "    int m" << i << ";\n";
+
+    os << "\n    LIGHTRAY_REFL_TYPE(namespace(::), record, (),\n";
+    for (std::size_t i = 0; i < members; ++i)
+        os << "        (var, m" << i << ", ())\n";
+    os << "    )\n};\n\n";
+
+    // Walks the members, and looks each of them up by name, as most reflection users do.
+    os << "auto total(const record& r) -> long\n{\n"
+          "    long result = 0;\n"
+          "    refl::type_info_<record>.data_members().for_each([&]<auto M>{ result += M.invoke(r); });\n";
+    for (std::size_t i = 0; i < members; ++i)
+        if (cached)
+            os << "    result += refl::meta_cache<record>::data_member<\"m" << i << "\">().invoke(r);\n";
+        else
+            os << "    result += refl::type_info_<record>.data_members().find_if([]<auto M>{ return mtp::value<M.name() == mtp::fixed_string(\"m"
+               << i << "\")>; }).invoke(r);\n";
+    os << "    return result;\n}\n";
+    return os.str();
+}
+
+// When extern, the vtable is declared by LIGHTRAY_REFL_DYN_EXTERN, as if instantiated in another translation unit.
+static auto generate_prototype(bool extern_vtable, std::size_t functions) -> std::string
+{
+    std::ostringstream os;
+    os << "#include <memory>\n"
+          "#include <lightray/reflection/dyn.hpp>\n"
+          "#include <lightray/reflection/gen_meta.hpp>\n\n"
+          "using namespace lightray;\n\n"
+          "struct prototype\n{\n";
+
+    for (std::size_t i = 0; i < functions; ++i)
+        os << "    int f" << i << "(int a);\n";
+
+    os << "\n    LIGHTRAY_REFL_TYPE(namespace(::), prototype, (),\n";
+    for (std::size_t i = 0; i < functions; ++i)
+        os << "        (func, f" << i << ", (id_accessor, interface_proxy((int)((int)(a))())))\n";
+    os << "    )\n};\n\n"
+          "struct implementation\n{\n";
+
+    for (std::size_t i = 0; i < functions; ++i)
+        os << "    int f" << i << "(int a) { return a + " << i << "; }\n";
+
+    os << "};\n\n";
+    if (extern_vtable)
+        os << "LIGHTRAY_REFL_DYN_EXTERN(prototype, implementation)\n\n";
+    os << "auto call_all(int a) -> int\n{\n"
+          "    refl::dyn<prototype> d = std::make_unique<implementation>();\n"
+          "    int result = 0;\n";
+    for (std::size_t i = 0; i < functions; ++i)
+        os << "    result += d.f" << i << "(a);\n";
+    os << "    return result;\n}\n";
+    return os.str();
+}
+
+// Takes the offsets of every member of a record, as one mtp::offset_of per member, as one mtp::offsets_of
+// probe, or as refl::member_offsets, which uses __builtin_offsetof.
+static auto generate_offsets(std::string_view kind, std::size_t members) -> std::string
+{
+    static constexpr std::string_view types[] = {"char", "int", "double", "short"};
+
+    std::ostringstream os;
+    os << "#include <array>\n"
+          "#include <cstddef>\n"
+          "#include <lightray/metaprogramming/offset_of.hpp>\n"
+          "#include <lightray/reflection/gen_meta.hpp>\n";
+    if (kind == "member_offsets")
+        os << "#include <lightray/reflection/layout.hpp>\n";
+    os << "\nusing namespace lightray;\n\n"
+          "struct record\n{\n";
+
+    for (std::size_t i = 0; i < members; ++i)
+        os << "    " << types[i % std::size(types)] << " m" << i << ";\n";
+
+    os << "\n    LIGHTRAY_REFL_TYPE(namespace(::), record, (),\n";
+    for (std::size_t i = 0; i < members; ++i)
+        os << "        (var, m" << i << ", ())\n";
+    os << "    )\n};\n\n";
+
+    if (kind == "offset_of")
+    {
+        os << "constexpr std::array<std::ptrdiff_t, " << members << "> offsets = {\n";
+        for (std::size_t i = 0; i < members; ++i)
+            os << "    mtp::offset_of<&record::m" << i << ">,\n";
+        os << "};\n\n";
+    }
+    else if (kind == "offsets_of")
+    {
+        os << "constexpr auto offsets = mtp::offsets_of<record>(\n";
+        for (std::size_t i = 0; i < members; ++i)
+            os << "    &record::m" << i << (i + 1 < members ? ",\n" : "\n");
+        os << ");\n\n";
+    }
+    else
+        os << "constexpr auto offsets = refl::member_offsets<record>;\n\n";
+
+    os << "auto offset(std::size_t i) -> std::ptrdiff_t { return offsets[i]; }\n";
+    return os.str();
+}
+
+// Iterates over a seq of elements, as LIGHTRAY_REFL_TYPE does over the members.
+static auto generate_seq(std::size_t elements) -> std::string
+{
+    std::ostringstream os;
+    os << "#include <lightray/preprocessor/seq/for_each.hpp>\n"
+          "#include <lightray/preprocessor/seq/size.hpp>\n\n"
+          "#define SEQ";
+    for (std::size_t i = 0; i < elements; ++i)
+        os << " (e" << i << ")";
+
+    os << "\n#define DECLARE(data, i, elem) constexpr int elem = i * data;\n\n"
+          "LIGHTRAY_PP_SEQ_FOR_EACH(DECLARE, 2, SEQ)\n"
+          "static_assert(LIGHTRAY_PP_SEQ_SIZE(SEQ) == " << elements << ");\n";
+    return os.str();
+}
+
+// Builds a dict_tuple of distinct element types, as dyn vtables are, and gets each key once.
+static auto generate_dict_tuple(std::string_view tuple, std::size_t keys) -> std::string
+{
+    std::ostringstream os;
+    os << "#include <lightray/metaprogramming/dict_tuple.hpp>\n"
+          "#include <lightray/metaprogramming/fixed_string.hpp>\n\n"
+          "using namespace lightray;\n\n"
+          "template <int I>\nstruct item { int value; };\n\n"
+          "auto total() -> int\n{\n"
+          "    const mtp::" << tuple << " t(\n        mtp::value_pack<";
+    for (std::size_t i = 0; i < keys; ++i)
+        os << (i ? ", " : "") << "mtp::fixed_string(\"k" << i << "\")";
+    os << ">";
+    for (std::size_t i = 0; i < keys; ++i)
+        os << ",\n        item<" << i << ">{" << i << "}";
+    os << "\n    );\n\n    int result = 0;\n";
+    for (std::size_t i = 0; i < keys; ++i)
+        os << "    result += t.get<mtp::fixed_string(\"k" << i << "\")>().value;\n";
+    os << "    return result;\n}\n";
+    return os.str();
+}
+
+// The type_pack algorithms as they are commonly written, by recursive class templates.
+static constexpr std::string_view recursive_algorithms = R"(
+template <typename... Ts>
+struct list {};
+
+template <typename T, typename... Ts>
+struct index_of { static constexpr std::size_t value = 0; };
+
+template <typename T, typename U, typename... Ts>
+struct index_of<T, U, Ts...> { static constexpr std::size_t value = std::is_same_v<T, U> ? 0 : 1 + index_of<T, Ts...>::value; };
+
+template <typename List, typename... Ts>
+struct unique { using type = List; };
+
+template <typename... As, typename T, typename... Ts>
+struct unique<list<As...>, T, Ts...>
+:   unique<std::conditional_t<(std::is_same_v<T, As> || ...), list<As...>, list<As..., T>>, Ts...>
+{};
+
+template <typename T, typename List>
+struct insert_by_alignment;
+
+template <typename T>
+struct insert_by_alignment<T, list<>> { using type = list<T>; };
+
+template <typename T, typename U, typename... Us>
+struct insert_by_alignment<T, list<U, Us...>>
+{
+    template <typename Rest>
+    struct prepend_u;
+
+    template <typename... Rs>
+    struct prepend_u<list<Rs...>> { using type = list<U, Rs...>; };
+
+    using type = typename std::conditional_t<
+        (alignof(T) < alignof(U)),
+        std::type_identity<list<T, U, Us...>>,
+        prepend_u<typename insert_by_alignment<T, list<Us...>>::type>
+    >::type;
+};
+
+template <typename List, typename... Ts>
+struct sort_by_alignment { using type = List; };
+
+template <typename List, typename T, typename... Ts>
+struct sort_by_alignment<List, T, Ts...> : sort_by_alignment<typename insert_by_alignment<T, List>::type, Ts...> {};
+
+template <typename Yes, typename No, typename... Ts>
+struct partition_by_size { using type = list<Yes, No>; };
+
+template <typename... Ys, typename... Ns, typename T, typename... Ts>
+struct partition_by_size<list<Ys...>, list<Ns...>, T, Ts...>
+:   partition_by_size<
+        std::conditional_t<(sizeof(T) > 2), list<Ys..., T>, list<Ys...>>,
+        std::conditional_t<(sizeof(T) > 2), list<Ns...>, list<Ns..., T>>,
+        Ts...
+    >
+{};
+
+template <std::size_t N, typename List, typename... Ts>
+struct take { using type = List; };
+
+template <std::size_t N, typename... As, typename T, typename... Ts>
+requires (N > 0)
+struct take<N, list<As...>, T, Ts...> : take<N - 1, list<As..., T>, Ts...> {};
+)";
+
+// Runs index_of, contains, unique, sort, partition and slice over a pack of types,
+// either with type_pack or with the recursive algorithms above.
+static auto generate_type_pack(bool recursive, std::size_t types) -> std::string
+{
+    std::ostringstream os;
+    os << "#include <cstddef>\n"
+          "#include <type_traits>\n"
+          "#include <lightray/metaprogramming/type_pack.hpp>\n"
+          "#include <lightray/metaprogramming/value.hpp>\n\n"
+          "using namespace lightray;\n\n"
+          "template <int I>\nstruct alignas(1 << I % 4) item { char bytes[1 << I % 3]; };\n";
+    if (recursive)
+        os << recursive_algorithms;
+
+    // Every type occurs twice, so that unique has something to remove.
+    os << "\n#define TYPES ";
+    for (std::size_t i = 0; i < types; ++i)
+        os << (i ? ", " : "") << "item<" << i % (types / 2) << ">";
+    os << "\n\n";
+
+    if (recursive)
+    {
+        for (std::size_t i = 0; i < types / 2; ++i)
+            os << "static_assert(index_of<item<" << i << ">, TYPES>::value == " << i << ");\n";
+        os << "static_assert(index_of<void, TYPES>::value == " << types << ");\n"
+              "using unique_types = unique<list<>, TYPES>::type;\n"
+              "using sorted_types = sort_by_alignment<list<>, TYPES>::type;\n"
+              "using partitioned_types = partition_by_size<list<>, list<>, TYPES>::type;\n"
+              "using sliced_types = take<" << types / 2 << ", list<>, TYPES>::type;\n";
+    }
+    else
+    {
+        os << "constexpr auto types = mtp::type_pack<TYPES>;\n";
+        for (std::size_t i = 0; i < types / 2; ++i)
+            os << "static_assert(types.index_of<item<" << i << ">>() == " << i << ");\n";
+        os << "static_assert(!types.contains<void>());\n"
+              "using unique_types = decltype(types.unique());\n"
+              "using sorted_types = decltype(types.sort([]<typename T>{ return mtp::value<alignof(T)>; }));\n"
+              "using partitioned_types = decltype(types.partition([]<typename T>{ return mtp::value<(sizeof(T) > 2)>; }));\n"
+              "using sliced_types = decltype(types.slice<0, " << types / 2 << ">());\n";
+    }
+    os << "\nauto sizes() -> std::size_t\n{\n"
+          "    return sizeof(unique_types) + sizeof(sorted_types) + sizeof(partitioned_types) + sizeof(sliced_types);\n}\n";
+    return os.str();
+}
+
+// Runs find_if over a type_pack and a value_pack, for 8 elements spread over the pack and
+// for one which is not there, so that the searches together fold over the whole pack.
+static auto generate_find_if(std::size_t elements) -> std::string
+{
+    std::ostringstream os;
+    os << "#include <type_traits>\n"
+          "#include <lightray/metaprogramming/type_pack.hpp>\n"
+          "#include <lightray/metaprogramming/value.hpp>\n"
+          "#include <lightray/metaprogramming/value_pack.hpp>\n\n"
+          "using namespace lightray;\n\n"
+          "template <int I>\nstruct item {};\n\n"
+          "constexpr auto types = mtp::type_pack<";
+    for (std::size_t i = 0; i < elements; ++i)
+        os << (i ? ", " : "") << "item<" << i << ">";
+    os << ">;\nconstexpr auto values = mtp::value_pack<";
+    for (std::size_t i = 0; i < elements; ++i)
+        os << (i ? ", " : "") << i;
+    os << ">;\n\n";
+
+    for (std::size_t k = 1; k <= 8; ++k)
+    {
+        const auto i = elements * k / 8 - 1;
+        os << "static_assert(std::is_same_v<decltype(types.find_if([]<typename T>{ return std::is_same<T, item<" << i
+           << ">>{}; }))::type, item<" << i << ">>);\n"
+              "static_assert(values.find_if([]<auto V>{ return mtp::value<V == " << i << ">; }) == " << i << ");\n";
+    }
+    os << "static_assert(std::is_void_v<decltype(types.find_if([]<typename T>{ return std::is_void<T>{}; }))>);\n"
+          "static_assert(std::is_void_v<decltype(values.find_if([]<auto V>{ return mtp::value<(V < 0)>; }))>);\n";
+    return os.str();
+}
+
+static auto benchmark_cases() -> std::vector<benchmark_case>
+{
+    std::vector<benchmark_case> cases;
+    for (bool cached : {false, true})
+    {
+        const std::string kind = cached ? "cached_record" : "record";
+        for (std::size_t n : {8, 64, 128, 256})
+            cases.push_back({kind + "_" + std::to_string(n), kind, n, generate_record(cached, n)});
+    }
+    for (bool extern_vtable : {false, true})
+    {
+        const std::string kind = extern_vtable ? "extern_prototype" : "prototype";
+        for (std::size_t n : {4, 32, 128})
+            cases.push_back({kind + "_" + std::to_string(n), kind, n, generate_prototype(extern_vtable, n)});
+    }
+    for (std::string kind : {"offset_of", "offsets_of", "member_offsets"})
+        for (std::size_t n : {16, 64, 128})
+            cases.push_back({kind + "_" + std::to_string(n), kind, n, generate_offsets(kind, n)});
+    for (std::size_t n : {256, 1024, 4096})
+        cases.push_back({"seq_" + std::to_string(n), "seq", n, generate_seq(n)});
+    for (std::string tuple : {"dict_tuple", "indexed_dict_tuple"})
+        for (std::size_t n : {16, 64, 256})
+            cases.push_back({tuple + "_" + std::to_string(n), tuple, n, generate_dict_tuple(tuple, n)});
+    for (bool recursive : {false, true})
+    {
+        const std::string kind = recursive ? "recursive_type_pack" : "type_pack";
+        for (std::size_t n : {16, 64, 256})
+            cases.push_back({kind + "_" + std::to_string(n), kind, n, generate_type_pack(recursive, n)});
+    }
+    for (std::size_t n : {32, 128, 512})
+        cases.push_back({"find_if_" + std::to_string(n), "find_if", n, generate_find_if(n)});
+    return cases;
+}
+
+static auto is_clang(const std::string& compiler) -> bool
+{
+    const auto command = compiler + " --version 2>/dev/null";
+    auto* pipe = ::popen(command.c_str(), "r");
+    if (!pipe)
+        return false;
+
+    std::string output;
+    char buffer[256];
+    while (std::fgets(buffer, sizeof(buffer), pipe))
+        output += buffer;
+    ::pclose(pipe);
+    return output.find("clang") != std::string::npos;
+}
+
+static auto count_occurrences(std::string_view text, std::string_view pattern) -> std::size_t
+{
+    std::size_t count = 0;
+    for (auto i = text.find(pattern); i != std::string_view::npos; i = text.find(pattern, i + pattern.size()))
+        ++count;
+    return count;
+}
+
+// Runs args, with its output and errors redirected to log, and measures it.
+static auto run(const std::vector<std::string>& args, const std::filesystem::path& log) -> benchmark_result
+{
+    std::vector<char*> argv;
+    for (const auto& arg : args)
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto pid = ::fork();
+    if (pid == 0)
+    {
+        const int fd = ::open(log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd >= 0)
+        {
+            ::dup2(fd, STDOUT_FILENO);
+            ::dup2(fd, STDERR_FILENO);
+        }
+        ::execvp(argv[0], argv.data());
+        std::perror(argv[0]);
+        ::_exit(127);
+    }
+
+    int status = 0;
+    rusage usage{};
+    if (pid < 0 || ::wait4(pid, &status, 0, &usage) < 0)
+        return {-1, 0, 0, std::nullopt, std::nullopt, std::nullopt};
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return {
+        WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status),
+        elapsed.count(),
+        usage.ru_maxrss,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt
+    };
+}
+
+static auto run_case(
+    const benchmark_case& c, const std::vector<std::string>& command, bool clang,
+    const std::filesystem::path& work, const std::filesystem::path& logs
+) -> benchmark_result
+{
+    const auto source = work / (c.name + ".cpp");
+    const auto object = work / (c.name + ".o");
+    std::ofstream(source) << c.source;
+
+    auto args = command;
+    if (std::none_of(args.begin(), args.end(), [](const std::string& a) { return a.starts_with("-std="); }))
+        args.push_back("-std=c++2b");
+    if (clang)
+        args.push_back("-ftime-trace");
+    args.insert(args.end(), {"-c", source.string(), "-o", object.string()});
+
+    auto result = run(args, logs / (c.name + ".log"));
+
+    // Mostly symbol names, which grow with every name spelled out in a template argument.
+    if (result.status == 0)
+        result.object_bytes = std::filesystem::file_size(object);
+
+    // Clang writes the trace next to the object file.
+    if (clang && result.status == 0)
+    {
+        std::ifstream trace(work / (c.name + ".json"));
+        const std::string text{std::istreambuf_iterator<char>(trace), std::istreambuf_iterator<char>()};
+        result.class_instantiations = count_occurrences(text, "\"name\":\"InstantiateClass\"");
+        result.function_instantiations = count_occurrences(text, "\"name\":\"InstantiateFunction\"");
+    }
+    return result;
+}
+
+static auto json_string(std::string_view s) -> std::string
+{
+    std::string result = "\"";
+    for (char ch : s)
+    {
+        if (ch == '"' || ch == '\\')
+            result += '\\';
+        if (static_cast<unsigned char>(ch) >= 0x20)
+            result += ch;
+    }
+    return result + "\"";
+}
+
+static auto json_optional(const std::optional<std::uintmax_t>& v) -> std::string
+{
+    return v ? std::to_string(*v) : "null";
+}
+
+auto main(int argc, char** argv) -> int
+{
+    std::optional<std::filesystem::path> output;
+    std::string filter;
+    std::vector<std::string> command;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--output" && i + 1 < argc)
+            output = argv[++i];
+        else if (arg == "--filter" && i + 1 < argc)
+            filter = argv[++i];
+        else if (arg == "--")
+        {
+            command.assign(argv + i + 1, argv + argc);
+            break;
+        }
+        else
+        {
+            std::cerr << "unknown argument: " << arg << '\n';
+            return 2;
+        }
+    }
+
+    if (command.empty())
+    {
+        std::cerr << "usage: driver [--output <file>] [--filter <substring>] -- <compiler> [<option>...]\n";
+        return 2;
+    }
+
+    const auto work = std::filesystem::temp_directory_path() / ("lightray_compile_time_" + std::to_string(::getpid()));
+    const auto logs = output ? std::filesystem::absolute(*output).parent_path() : std::filesystem::current_path();
+    std::filesystem::create_directories(work);
+    std::filesystem::create_directories(logs);
+
+    const bool clang = is_clang(command.front());
+
+    std::ostringstream report;
+    report << "{\n  \"compiler\": " << json_string(command.front()) << ",\n  \"cases\": [";
+
+    bool first = true;
+    int failures = 0;
+    for (const auto& c : benchmark_cases())
+    {
+        if (c.name.find(filter) == std::string::npos)
+            continue;
+
+        const auto r = run_case(c, command, clang, work, logs);
+        failures += r.status != 0;
+        std::cerr << c.name << ": " << (r.status == 0 ? "ok" : "failed") << ", " << r.seconds << " s, " << r.peak_memory_kib << " KiB, "
+                  << json_optional(r.object_bytes) << " object bytes\n";
+
+        report << (first ? "\n" : ",\n")
+               << "    {\"name\": " << json_string(c.name)
+               << ", \"kind\": " << json_string(c.kind)
+               << ", \"size\": " << c.count
+               << ", \"status\": " << r.status
+               << ", \"seconds\": " << r.seconds
+               << ", \"peak_memory_kib\": " << r.peak_memory_kib
+               << ", \"class_instantiations\": " << json_optional(r.class_instantiations)
+               << ", \"function_instantiations\": " << json_optional(r.function_instantiations)
+               << ", \"object_bytes\": " << json_optional(r.object_bytes)
+               << "}";
+        first = false;
+    }
+    report << "\n  ]\n}\n";
+
+    std::filesystem::remove_all(work);
+
+    if (output)
+        std::ofstream(*output) << report.str();
+    else
+        std::cout << report.str();
+
+    // Failing cases are still in the report, but fail the run.
+    return failures == 0 ? 0 : 1;
+}
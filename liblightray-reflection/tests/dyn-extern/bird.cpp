@@ -0,0 +1,16 @@
+#include "bird.hpp"
+
+
+
+LIGHTRAY_REFL_DYN_INSTANTIATE(bird_prototype, basic_bird)
+LIGHTRAY_REFL_DYN_INSTANTIATE(bird_prototype, basic_bird, true)
+
+auto instantiated_bird_vtable() noexcept -> const void*
+{
+    return &lightray::refl::detail::dyn_vtable<basic_bird, bird_prototype, false>;
+}
+
+auto instantiated_cloneable_bird_vtable() noexcept -> const void*
+{
+    return &lightray::refl::detail::dyn_vtable<basic_bird, bird_prototype, true>;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+
+#include <lightray/reflection/dyn.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+
+
+
+struct bird_prototype
+{
+    void eat(int food);
+    std::string speak() const;
+
+    LIGHTRAY_REFL_TYPE(namespace(::), bird_prototype, (),
+        (func, eat, (id_accessor, interface_proxy((void)((int)(food))())))
+        (func, speak, (id_accessor, interface_proxy((std::string)()(const))))
+    )
+
+}; // struct bird_prototype
+
+struct basic_bird
+{
+private:
+    int _food = {};
+
+public:
+    void eat(int food) { _food += food * 2; }
+    std::string speak() const { return "I ate " + std::to_string(_food) + " food TWEET!"; }
+
+}; // struct basic_bird
+
+// Seen by every translation unit, so that only bird.cpp instantiates these vtables.
+LIGHTRAY_REFL_DYN_EXTERN(bird_prototype, basic_bird)
+LIGHTRAY_REFL_DYN_EXTERN(bird_prototype, basic_bird, true)
+
+// The addresses of the vtables as instantiated by bird.cpp.
+auto instantiated_bird_vtable() noexcept -> const void*;
+auto instantiated_cloneable_bird_vtable() noexcept -> const void*;
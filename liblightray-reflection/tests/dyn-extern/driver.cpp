@@ -0,0 +1,52 @@
+#include <iostream>
+#include <memory>
+
+#include <lightray/reflection/dyn.hpp>
+
+#include "bird.hpp"
+
+
+
+using namespace lightray;
+
+static_assert(refl::detail::dyn_vtable_is_extern<basic_bird, bird_prototype>);
+static_assert(refl::detail::dyn_vtable_is_extern<basic_bird, bird_prototype, true>);
+
+static auto check(bool condition, const char* what) -> bool
+{
+    if (!condition)
+        std::cerr << "failed: " << what << '\n';
+    return condition;
+}
+
+/*
+ * Constructs and calls through dyns whose vtables this translation unit only declares. Had it
+ * instantiated its own, their addresses would differ from bird.cpp's wherever the compiler gives
+ * the const dyn_vtable internal linkage, as g++ does.
+ */
+int main()
+{
+    bool ok = true;
+
+    refl::dyn<bird_prototype> bird = std::make_unique<basic_bird>();
+    bird.eat(5);
+    ok &= check(bird.speak() == "I ate 10 food TWEET!", "call through an extern vtable");
+
+    refl::dyn<bird_prototype, true> other_bird = std::make_unique<basic_bird>();
+    refl::dyn<bird_prototype, true> copy = other_bird;
+    copy.eat(1);
+    ok &= check(copy.speak() == "I ate 2 food TWEET!", "clone through an extern vtable");
+    ok &= check(other_bird.speak() == "I ate 0 food TWEET!", "clone is independent");
+
+    ok &= check(
+        refl::detail::dyn_vtable_pointer<basic_bird, bird_prototype, false, std::default_delete<basic_bird>>() == instantiated_bird_vtable(),
+        "dyn uses the vtable of the instantiating translation unit"
+    );
+    ok &= check(
+        refl::detail::dyn_vtable_pointer<basic_bird, bird_prototype, true, std::default_delete<basic_bird>>() == instantiated_cloneable_bird_vtable(),
+        "cloneable dyn uses the vtable of the instantiating translation unit"
+    );
+
+    return ok ? 0 : 1;
+
+} // fn main
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+
+/*
+ * The result of one benchmark case.
+ *
+ * seconds / iterations is the time of one operation, whatever the case defines that to be,
+ * e.g. hashing one key. metrics holds anything else worth reporting, e.g. the size of a patch.
+ */
+struct benchmark_result
+{
+    double seconds;
+    std::size_t iterations;
+    std::vector<std::pair<std::string, double>> metrics;
+
+}; // struct benchmark_result
+
+struct benchmark_case
+{
+    std::string name;
+    std::string kind;
+    std::size_t count;
+    std::function<benchmark_result()> run;
+
+}; // struct benchmark_case
+
+// Keeps the compiler from optimizing value, and the computation of it, away.
+template <typename T>
+inline void do_not_optimize(const T& value) noexcept
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/*
+ * Calls op, which performs ops_per_call operations, until at least min_seconds have passed,
+ * after one untimed call to warm the caches up.
+ */
+template <typename Op>
+auto measure(Op&& op, std::size_t ops_per_call = 1, double min_seconds = 0.2) -> benchmark_result
+{
+    op();
+
+    std::size_t calls = 0;
+    const auto start = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed{};
+    do
+    {
+        op();
+        ++calls;
+        elapsed = std::chrono::steady_clock::now() - start;
+    }
+    while (elapsed.count() < min_seconds);
+
+    return {elapsed.count(), calls * ops_per_call, {}};
+}
+
+// The cases of each benchmarked header, see <header>.cpp.
+auto hash_cases() -> std::vector<benchmark_case>;
+auto compare_cases() -> std::vector<benchmark_case>;
+auto patch_cases() -> std::vector<benchmark_case>;
+auto rpc_cases() -> std::vector<benchmark_case>;
+auto ecs_cases() -> std::vector<benchmark_case>;
+auto query_cases() -> std::vector<benchmark_case>;
@@ -0,0 +1,97 @@
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <lightray/reflection/compare.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+
+#include "benchmark.hpp"
+
+
+
+using namespace lightray;
+
+
+
+namespace
+{
+    // A deduplicated record: the integers form one memcmp run, the double is compared by value.
+    struct trade
+    {
+        std::uint64_t id;
+        std::uint64_t timestamp;
+        std::int64_t price;
+        std::uint32_t quantity;
+        std::uint32_t venue;
+        std::uint64_t account;
+        double fee;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), trade, (),
+            (var, id, ())
+            (var, timestamp, ())
+            (var, price, ())
+            (var, quantity, ())
+            (var, venue, ())
+            (var, account, ())
+            (var, fee, ())
+        )
+
+    }; // struct trade
+
+    // The operator== written by hand which refl::equal replaces.
+    auto hand_equal(const trade& a, const trade& b) noexcept -> bool
+    {
+        return a.id == b.id && a.timestamp == b.timestamp && a.price == b.price && a.quantity == b.quantity
+            && a.venue == b.venue && a.account == b.account && a.fee == b.fee;
+    }
+
+    auto hand_compare(const trade& a, const trade& b) noexcept -> std::partial_ordering
+    {
+        if (auto c = a.id <=> b.id; c != 0) return c;
+        if (auto c = a.timestamp <=> b.timestamp; c != 0) return c;
+        if (auto c = a.price <=> b.price; c != 0) return c;
+        if (auto c = a.quantity <=> b.quantity; c != 0) return c;
+        if (auto c = a.venue <=> b.venue; c != 0) return c;
+        if (auto c = a.account <=> b.account; c != 0) return c;
+        return a.fee <=> b.fee;
+    }
+
+    // Pairs of records which are equal, except every 16th pair whose account differs.
+    auto trade_pairs(std::size_t n) -> std::vector<trade>
+    {
+        std::vector<trade> trades;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const trade t{i, 1'700'000'000 + i, static_cast<std::int64_t>(i % 1000), 100, 7, i / 3, 0.25};
+            trades.push_back(t);
+            trades.push_back(t);
+            trades.back().account += i % 16 == 0;
+        }
+        return trades;
+    }
+
+    // Compares every pair once, i.e. one operation per pair.
+    template <typename Op>
+    auto compare_all(const std::vector<trade>& trades, Op op) -> benchmark_result
+    {
+        return measure([&] {
+            std::size_t equal = 0;
+            for (std::size_t i = 0; i < trades.size(); i += 2)
+                equal += op(trades[i], trades[i + 1]) == 0;
+            do_not_optimize(equal);
+        }, trades.size() / 2);
+    }
+
+} // namespace
+
+auto compare_cases() -> std::vector<benchmark_case>
+{
+    constexpr std::size_t n = 100'000;
+    return {
+        {"equal_refl", "equal", n, [] { return compare_all(trade_pairs(n), [](const trade& a, const trade& b) { return !refl::equal(a, b); }); }},
+        {"equal_hand", "equal", n, [] { return compare_all(trade_pairs(n), [](const trade& a, const trade& b) { return !hand_equal(a, b); }); }},
+        {"compare_refl", "compare", n, [] { return compare_all(trade_pairs(n), [](const trade& a, const trade& b) { return refl::compare(a, b); }); }},
+        {"compare_hand", "compare", n, [] { return compare_all(trade_pairs(n), hand_compare); }},
+    };
+}
@@ -0,0 +1,108 @@
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmark.hpp"
+
+
+/*
+ * Runtime benchmark of the reflection generated algorithms.
+ *
+ * Runs each case, i.e. an operation such as hashing a key, comparing two records or
+ * applying a patch, against both the reflection generated code and the code it replaces
+ * where there is one, and reports, as JSON, for each of them:
+ *  ns_per_op:  wall time of one operation, averaged over at least 0.2 s of operations
+ *  metrics:    anything else the case measures, e.g. the size of a patch in bytes
+ *
+ * Usage:
+ *  driver [--output <file>] [--filter <substring>]
+ *
+ * Build it with optimizations, the timings are meaningless otherwise.
+ */
+
+
+
+static auto benchmark_cases() -> std::vector<benchmark_case>
+{
+    std::vector<benchmark_case> cases;
+    for (auto&& group : {hash_cases(), compare_cases(), patch_cases(), rpc_cases(), ecs_cases(), query_cases()})
+        cases.insert(cases.end(), group.begin(), group.end());
+    return cases;
+}
+
+static auto json_string(std::string_view s) -> std::string
+{
+    std::string result = "\"";
+    for (char ch : s)
+    {
+        if (ch == '"' || ch == '\\')
+            result += '\\';
+        if (static_cast<unsigned char>(ch) >= 0x20)
+            result += ch;
+    }
+    return result + "\"";
+}
+
+auto main(int argc, char** argv) -> int
+{
+    std::optional<std::filesystem::path> output;
+    std::string filter;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--output" && i + 1 < argc)
+            output = argv[++i];
+        else if (arg == "--filter" && i + 1 < argc)
+            filter = argv[++i];
+        else
+        {
+            std::cerr << "unknown argument: " << arg << '\n'
+                      << "usage: driver [--output <file>] [--filter <substring>]\n";
+            return 2;
+        }
+    }
+
+    std::ostringstream report;
+    report << "{\n  \"cases\": [";
+
+    bool first = true;
+    for (const auto& c : benchmark_cases())
+    {
+        if (c.name.find(filter) == std::string::npos)
+            continue;
+
+        const auto r = c.run();
+        const double ns_per_op = r.seconds * 1e9 / static_cast<double>(r.iterations);
+        std::cerr << c.name << ": " << ns_per_op << " ns/op";
+        for (const auto& [metric, value] : r.metrics)
+            std::cerr << ", " << metric << " " << value;
+        std::cerr << '\n';
+
+        report << (first ? "\n" : ",\n")
+               << "    {\"name\": " << json_string(c.name)
+               << ", \"kind\": " << json_string(c.kind)
+               << ", \"size\": " << c.count
+               << ", \"ns_per_op\": " << ns_per_op
+               << ", \"metrics\": {";
+        for (std::size_t i = 0; i < r.metrics.size(); ++i)
+            report << (i ? ", " : "") << json_string(r.metrics[i].first) << ": " << r.metrics[i].second;
+        report << "}}";
+        first = false;
+    }
+    report << "\n  ]\n}\n";
+
+    if (output)
+    {
+        std::filesystem::create_directories(std::filesystem::absolute(*output).parent_path());
+        std::ofstream(*output) << report.str();
+    }
+    else
+        std::cout << report.str();
+}
@@ -0,0 +1,145 @@
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <lightray/metaprogramming/work_stealing_executor.hpp>
+#include <lightray/reflection/ecs.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+
+#include "benchmark.hpp"
+
+
+
+using namespace lightray;
+namespace ecs = lightray::refl::ecs;
+
+
+
+namespace
+{
+    struct position
+    {
+        float x;
+        float y;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), position, (),
+            (var, x, ())
+            (var, y, ())
+        )
+
+    }; // struct position
+
+    struct velocity
+    {
+        float dx;
+        float dy;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), velocity, (),
+            (var, dx, ())
+            (var, dy, ())
+        )
+
+    }; // struct velocity
+
+    struct health
+    {
+        int points;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), health, (),
+            (var, points, ())
+        )
+
+    }; // struct health
+
+    // Half of the moving entities also have health, so that views span two archetypes.
+    auto populate(std::size_t entities) -> std::unique_ptr<ecs::registry>
+    {
+        auto r = std::make_unique<ecs::registry>();
+        for (std::size_t i = 0; i < entities; ++i)
+            if (i % 2 == 0)
+                r->create(position{1.0f, 2.0f}, velocity{0.5f, 0.25f});
+            else
+                r->create(position{1.0f, 2.0f}, velocity{0.5f, 0.25f}, health{100});
+        return r;
+    }
+
+    // Moves every entity once, i.e. one operation per entity.
+    auto for_each_case(std::size_t entities) -> benchmark_result
+    {
+        const auto r = populate(entities);
+        const auto view = r->view<position, velocity>();
+        return measure([&] {
+            view.for_each([](position& p, const velocity& v) {
+                p.x += v.dx;
+                p.y += v.dy;
+            });
+        }, entities);
+    }
+
+    auto for_each_chunk_case(std::size_t entities) -> benchmark_result
+    {
+        const auto r = populate(entities);
+        const auto view = r->view<position, velocity>();
+        return measure([&] {
+            view.for_each_chunk([](std::span<const ecs::entity>, std::span<position> ps, std::span<velocity> vs) {
+                for (std::size_t i = 0; i < ps.size(); ++i)
+                {
+                    ps[i].x += vs[i].dx;
+                    ps[i].y += vs[i].dy;
+                }
+            });
+        }, entities);
+    }
+
+    auto parallel_for_each_case(std::size_t entities) -> benchmark_result
+    {
+        const auto r = populate(entities);
+        const auto view = r->view<position, velocity>();
+        mtp::work_stealing_executor executor;
+        return measure([&] {
+            view.parallel_for_each(executor, [](position& p, const velocity& v) {
+                p.x += v.dx;
+                p.y += v.dy;
+            });
+        }, entities);
+    }
+
+    // The array of structs an ECS replaces, as the baseline of dense iteration.
+    auto array_of_structs_case(std::size_t entities) -> benchmark_result
+    {
+        struct moving
+        {
+            position p;
+            velocity v;
+            health h;
+            bool has_health;
+        };
+
+        std::vector<moving> objects(entities, moving{{1.0f, 2.0f}, {0.5f, 0.25f}, {100}, false});
+        return measure([&] {
+            for (auto& o : objects)
+            {
+                o.p.x += o.v.dx;
+                o.p.y += o.v.dy;
+            }
+            do_not_optimize(objects.front());
+        }, entities);
+    }
+
+} // namespace
+
+auto ecs_cases() -> std::vector<benchmark_case>
+{
+    std::vector<benchmark_case> cases;
+    for (std::size_t n : {100'000, 1'000'000, 10'000'000})
+    {
+        const auto suffix = "_" + std::to_string(n);
+        cases.push_back({"ecs_for_each" + suffix, "ecs_for_each", n, [n] { return for_each_case(n); }});
+        cases.push_back({"ecs_for_each_chunk" + suffix, "ecs_for_each_chunk", n, [n] { return for_each_chunk_case(n); }});
+        cases.push_back({"ecs_parallel_for_each" + suffix, "ecs_parallel_for_each", n, [n] { return parallel_for_each_case(n); }});
+        cases.push_back({"ecs_array_of_structs" + suffix, "ecs_array_of_structs", n, [n] { return array_of_structs_case(n); }});
+    }
+    return cases;
+}
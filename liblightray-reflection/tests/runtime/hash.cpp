@@ -0,0 +1,130 @@
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <lightray/metaprogramming/tuple_util.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/hash.hpp>
+
+#include "benchmark.hpp"
+
+
+
+using namespace lightray;
+
+
+
+namespace
+{
+    // Padding-free, hashed in one pass.
+    struct packed_key
+    {
+        std::uint32_t id;
+        std::uint16_t shard;
+        std::uint16_t kind;
+
+        auto operator==(const packed_key&) const -> bool = default;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), packed_key, (),
+            (var, id, ())
+            (var, shard, ())
+            (var, kind, ())
+        )
+
+    }; // struct packed_key
+
+    // Padded, hashed member by member.
+    struct padded_key
+    {
+        std::uint8_t tag;
+        std::uint64_t value;
+        std::string name;
+
+        auto operator==(const padded_key&) const -> bool = default;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), padded_key, (),
+            (var, tag, ())
+            (var, value, ())
+            (var, name, ())
+        )
+
+    }; // struct padded_key
+
+    // The std::hash specializations written by hand which refl::hash replaces.
+    struct hand_hash
+    {
+        auto operator()(const packed_key& k) const noexcept -> std::size_t
+        {
+            std::size_t seed = 0;
+            mtp::combine_hash(seed, std::hash<std::uint32_t>{}(k.id));
+            mtp::combine_hash(seed, std::hash<std::uint16_t>{}(k.shard));
+            mtp::combine_hash(seed, std::hash<std::uint16_t>{}(k.kind));
+            return seed;
+        }
+
+        auto operator()(const padded_key& k) const noexcept -> std::size_t
+        {
+            std::size_t seed = 0;
+            mtp::combine_hash(seed, std::hash<std::uint8_t>{}(k.tag));
+            mtp::combine_hash(seed, std::hash<std::uint64_t>{}(k.value));
+            mtp::combine_hash(seed, std::hash<std::string>{}(k.name));
+            return seed;
+        }
+
+    }; // struct hand_hash
+
+    auto packed_keys(std::size_t n) -> std::vector<packed_key>
+    {
+        std::vector<packed_key> keys;
+        for (std::size_t i = 0; i < n; ++i)
+            keys.push_back({static_cast<std::uint32_t>(i), static_cast<std::uint16_t>(i % 16), static_cast<std::uint16_t>(i % 3)});
+        return keys;
+    }
+
+    auto padded_keys(std::size_t n) -> std::vector<padded_key>
+    {
+        std::vector<padded_key> keys;
+        for (std::size_t i = 0; i < n; ++i)
+            keys.push_back({static_cast<std::uint8_t>(i % 7), i * 31, "key-" + std::to_string(i)});
+        return keys;
+    }
+
+    // Hashes every key once, i.e. one operation per key.
+    template <typename Hash, typename Key>
+    auto hash_all(const std::vector<Key>& keys) -> benchmark_result
+    {
+        return measure([&] {
+            for (const auto& k : keys)
+                do_not_optimize(Hash{}(k));
+        }, keys.size());
+    }
+
+    // Inserts every key into a fresh set, i.e. one operation per key.
+    template <typename Hash, typename Key>
+    auto insert_all(const std::vector<Key>& keys) -> benchmark_result
+    {
+        return measure([&] {
+            std::unordered_set<Key, Hash> set;
+            for (const auto& k : keys)
+                set.insert(k);
+            do_not_optimize(set.size());
+        }, keys.size());
+    }
+
+} // namespace
+
+auto hash_cases() -> std::vector<benchmark_case>
+{
+    constexpr std::size_t n = 100'000;
+    return {
+        {"hash_packed_refl", "hash", n, [] { return hash_all<refl::hash<packed_key>>(packed_keys(n)); }},
+        {"hash_packed_hand", "hash", n, [] { return hash_all<hand_hash>(packed_keys(n)); }},
+        {"hash_padded_refl", "hash", n, [] { return hash_all<refl::hash<padded_key>>(padded_keys(n)); }},
+        {"hash_padded_hand", "hash", n, [] { return hash_all<hand_hash>(padded_keys(n)); }},
+        {"hash_set_insert_packed_refl", "hash_set_insert", n, [] { return insert_all<refl::hash<packed_key>>(packed_keys(n)); }},
+        {"hash_set_insert_packed_hand", "hash_set_insert", n, [] { return insert_all<hand_hash>(packed_keys(n)); }},
+    };
+}
@@ -0,0 +1,107 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/patch.hpp>
+#include <lightray/reflection/serialize.hpp>
+
+#include "benchmark.hpp"
+
+
+
+using namespace lightray;
+
+
+
+namespace
+{
+    struct shard
+    {
+        std::uint64_t f0, f1, f2, f3, f4, f5, f6, f7, f8, f9;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), shard, (),
+            (var, f0, ()) (var, f1, ()) (var, f2, ()) (var, f3, ()) (var, f4, ())
+            (var, f5, ()) (var, f6, ()) (var, f7, ()) (var, f8, ()) (var, f9, ())
+        )
+
+    }; // struct shard
+
+    // 100 replicated fields, in 10 nested shards.
+    struct state
+    {
+        shard s0, s1, s2, s3, s4, s5, s6, s7, s8, s9;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), state, (),
+            (var, s0, ()) (var, s1, ()) (var, s2, ()) (var, s3, ()) (var, s4, ())
+            (var, s5, ()) (var, s6, ()) (var, s7, ()) (var, s8, ()) (var, s9, ())
+        )
+
+    }; // struct state
+
+    auto field(state& s, std::size_t i) -> std::uint64_t&
+    {
+        constexpr shard state::* shards[] = {&state::s0, &state::s1, &state::s2, &state::s3, &state::s4, &state::s5, &state::s6, &state::s7, &state::s8, &state::s9};
+        constexpr std::uint64_t shard::* fields[] = {&shard::f0, &shard::f1, &shard::f2, &shard::f3, &shard::f4, &shard::f5, &shard::f6, &shard::f7, &shard::f8, &shard::f9};
+        return s.*shards[i / 10].*fields[i % 10];
+    }
+
+    // Snapshots of the state, each of which differs from the previous one in 1% of the fields.
+    auto churned_states(std::size_t n) -> std::vector<state>
+    {
+        std::vector<state> states(n);
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            states[i] = states[i - 1];
+            ++field(states[i], i * 37 % 100);
+        }
+        return states;
+    }
+
+    auto average_patch_bytes(const std::vector<state>& states) -> double
+    {
+        std::size_t bytes = 0;
+        for (std::size_t i = 1; i < states.size(); ++i)
+            bytes += refl::diff(states[i - 1], states[i]).size();
+        return static_cast<double>(bytes) / static_cast<double>(states.size() - 1);
+    }
+
+} // namespace
+
+auto patch_cases() -> std::vector<benchmark_case>
+{
+    constexpr std::size_t n = 1'000;
+    return {
+        {"patch_diff_1pct", "patch", n, [] {
+            const auto states = churned_states(n);
+            auto result = measure([&] {
+                for (std::size_t i = 1; i < states.size(); ++i)
+                    do_not_optimize(refl::diff(states[i - 1], states[i]).size());
+            }, n - 1);
+            result.metrics = {{"patch_bytes", average_patch_bytes(states)}};
+            return result;
+        }},
+        {"patch_apply_1pct", "patch", n, [] {
+            const auto states = churned_states(n);
+            std::vector<refl::patch<state>> patches;
+            for (std::size_t i = 1; i < states.size(); ++i)
+                patches.push_back(refl::diff(states[i - 1], states[i]));
+
+            return measure([&] {
+                state replica = states.front();
+                for (const auto& p : patches)
+                    refl::apply_patch(replica, p);
+                do_not_optimize(replica);
+            }, n - 1);
+        }},
+        {"patch_snapshot", "patch", n, [] {
+            const auto states = churned_states(n);
+            auto result = measure([&] {
+                for (std::size_t i = 1; i < states.size(); ++i)
+                    do_not_optimize(refl::serialize(states[i]).size());
+            }, n - 1);
+            result.metrics = {{"snapshot_bytes", static_cast<double>(refl::serialize(states.front()).size())}};
+            return result;
+        }},
+    };
+}
@@ -0,0 +1,155 @@
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/query.hpp>
+
+#include "benchmark.hpp"
+
+
+
+using namespace lightray;
+namespace q = lightray::refl::q;
+
+
+
+namespace
+{
+    enum class side : std::uint8_t { buy, sell };
+
+    struct trade
+    {
+        std::uint32_t symbol;
+        side direction;
+        double price;
+        std::int32_t quantity;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), trade, (),
+            (var, symbol, ())
+            (var, direction, ())
+            (var, price, ())
+            (var, quantity, ())
+        )
+
+    }; // struct trade
+
+    auto make_trades(std::size_t n) -> std::vector<trade>
+    {
+        std::vector<trade> trades;
+        trades.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+            trades.push_back({
+                static_cast<std::uint32_t>(i % 64),
+                (i * 7) % 3 ? side::sell : side::buy,
+                50.0 + static_cast<double>((i * 31) % 100),
+                static_cast<std::int32_t>(i % 10)
+            });
+        return trades;
+    }
+
+    // The same records, one vector per data member, as a column source of refl::q.
+    struct trade_columns
+    {
+        std::vector<side> direction;
+        std::vector<double> price;
+        std::vector<std::int32_t> quantity;
+
+        explicit trade_columns(const std::vector<trade>& trades)
+        {
+            for (const auto& t : trades)
+            {
+                direction.push_back(t.direction);
+                price.push_back(t.price);
+                quantity.push_back(t.quantity);
+            }
+        }
+
+        auto size() const noexcept -> std::size_t { return price.size(); }
+
+        template <mtp::fixed_string Name>
+        auto column() const -> auto
+        {
+            if constexpr (Name == mtp::fixed_string{"direction"})
+                return std::span{direction};
+            else if constexpr (Name == mtp::fixed_string{"price"})
+                return std::span{price};
+            else
+                return std::span{quantity};
+        }
+
+    }; // struct trade_columns
+
+    constexpr std::size_t trade_count = 1'000'000;
+
+    const auto& trades()
+    {
+        static const auto trades = make_trades(trade_count);
+        return trades;
+    }
+
+    const auto pred = q::field<"price"> > 100.0 && q::field<"direction"> == side::buy;
+
+    auto query_aggregate_case() -> benchmark_result
+    {
+        return measure([] {
+            do_not_optimize(q::aggregate(trades(), pred, q::sum(q::field<"quantity">), q::count()));
+        }, trade_count);
+    }
+
+    auto query_aggregate_columns_case() -> benchmark_result
+    {
+        const trade_columns columns{trades()};
+        return measure([&] {
+            do_not_optimize(q::aggregate(columns, pred, q::sum(q::field<"quantity">), q::count()));
+        }, trade_count);
+    }
+
+    auto hand_aggregate_case() -> benchmark_result
+    {
+        return measure([] {
+            std::int64_t quantity = 0;
+            std::size_t count = 0;
+            for (const auto& t : trades())
+                if (t.price > 100.0 && t.direction == side::buy)
+                {
+                    quantity += t.quantity;
+                    ++count;
+                }
+            do_not_optimize(std::tuple{quantity, count});
+        }, trade_count);
+    }
+
+    auto query_filter_case() -> benchmark_result
+    {
+        return measure([] {
+            do_not_optimize(q::filter(trades(), pred));
+        }, trade_count);
+    }
+
+    auto hand_filter_case() -> benchmark_result
+    {
+        return measure([] {
+            std::vector<trade> result;
+            for (const auto& t : trades())
+                if (t.price > 100.0 && t.direction == side::buy)
+                    result.push_back(t);
+            do_not_optimize(result);
+        }, trade_count);
+    }
+
+} // namespace
+
+auto query_cases() -> std::vector<benchmark_case>
+{
+    return {
+        {"query_aggregate", "query_aggregate", trade_count, query_aggregate_case},
+        {"query_aggregate_columns", "query_aggregate", trade_count, query_aggregate_columns_case},
+        {"query_aggregate_hand", "query_aggregate", trade_count, hand_aggregate_case},
+        {"query_filter", "query_filter", trade_count, query_filter_case},
+        {"query_filter_hand", "query_filter", trade_count, hand_filter_case},
+    };
+}
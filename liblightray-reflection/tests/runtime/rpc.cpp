@@ -0,0 +1,127 @@
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <lightray/reflection/dyn.hpp>
+#include <lightray/reflection/gen_meta.hpp>
+#include <lightray/reflection/rpc.hpp>
+#include <lightray/reflection/rpc_unix_socket.hpp>
+
+#include "benchmark.hpp"
+
+
+
+using namespace lightray;
+namespace rpc = lightray::refl::rpc;
+
+
+
+namespace
+{
+    struct adder_prototype
+    {
+        int add(int a, int b) const;
+
+        LIGHTRAY_REFL_TYPE(namespace(::), adder_prototype, (),
+            (func, add, (id_accessor, interface_proxy((int)((int)(a), (int)(b))(const))))
+        )
+
+    }; // struct adder_prototype
+
+    struct adder
+    {
+        int add(int a, int b) const { return a + b; }
+
+    }; // struct adder
+
+    constexpr std::size_t calls_per_thread = 2'000;
+
+    // Makes calls_per_thread calls through each client, from a thread per client, i.e. one operation per call.
+    template <typename Client>
+    auto call_from_threads(std::vector<Client>& clients) -> benchmark_result
+    {
+        auto result = measure([&] {
+            std::vector<std::thread> threads;
+            for (auto& client : clients)
+                threads.emplace_back([&client] {
+                    int total = 0;
+                    for (std::size_t i = 0; i < calls_per_thread; ++i)
+                        total += client.add(static_cast<int>(i), 1);
+                    do_not_optimize(total);
+                });
+            for (auto& thread : threads)
+                thread.join();
+        }, clients.size() * calls_per_thread);
+
+        result.metrics = {{"calls_per_second", static_cast<double>(result.iterations) / result.seconds}};
+        return result;
+    }
+
+    // Calls add through clients sharing one queue_transport, served by a single thread.
+    auto queue_case(std::size_t threads) -> benchmark_result
+    {
+        adder impl;
+        auto server = rpc::make_server<adder_prototype>(impl);
+
+        rpc::queue_transport transport;
+        std::thread serving([&] { transport.serve(server); });
+
+        std::vector<rpc::client<adder_prototype, rpc::queue_transport>> clients(threads, rpc::client<adder_prototype, rpc::queue_transport>(transport));
+        const auto result = call_from_threads(clients);
+
+        transport.close();
+        serving.join();
+        return result;
+    }
+
+    // Calls add through one Unix domain socket connection per thread, each served by its own thread.
+    auto unix_socket_case(std::size_t threads) -> benchmark_result
+    {
+        const auto path = std::filesystem::temp_directory_path() / ("lightray_rpc_benchmark_" + std::to_string(::getpid()) + ".sock");
+
+        adder impl;
+        auto server = rpc::make_server<adder_prototype>(impl);
+        rpc::unix_socket_listener listener(path);
+
+        std::vector<std::thread> serving;
+        std::vector<rpc::unix_socket_transport> transports;
+        transports.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i)
+        {
+            transports.push_back(rpc::unix_socket_transport::connect(path));
+            serving.emplace_back([&listener, &server, transport = listener.accept()]() mutable { transport.serve(server); });
+        }
+
+        std::vector<rpc::client<adder_prototype, rpc::unix_socket_transport>> clients;
+        for (auto& transport : transports)
+            clients.emplace_back(transport);
+        const auto result = call_from_threads(clients);
+
+        transports.clear();
+        for (auto& thread : serving)
+            thread.join();
+        return result;
+    }
+
+} // namespace
+
+auto rpc_cases() -> std::vector<benchmark_case>
+{
+    return {
+        {"rpc_dyn", "rpc", 1, [] {
+            refl::dyn<adder_prototype> local = std::make_unique<adder>();
+            std::vector<refl::dyn<adder_prototype>> clients;
+            clients.push_back(std::move(local));
+            return call_from_threads(clients);
+        }},
+        {"rpc_queue_latency", "rpc_queue", 1, [] { return queue_case(1); }},
+        {"rpc_queue_throughput_4", "rpc_queue", 4, [] { return queue_case(4); }},
+        {"rpc_unix_socket_latency", "rpc_unix_socket", 1, [] { return unix_socket_case(1); }},
+        {"rpc_unix_socket_throughput_4", "rpc_unix_socket", 4, [] { return unix_socket_case(4); }},
+    };
+}